@@ -0,0 +1,59 @@
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <graph/adjmatrix.hpp>
+#include <graph/bfs.hpp>
+#include <graph/dfs.hpp>
+#include "benchmark.hpp"
+
+// Compares the storage layouts of adjmatrix for breadth and depth first
+// search on dense graphs.
+//
+// Usage: bench_adjmatrix_layout [vertices] [density in percent]
+
+namespace
+{
+template <class Layout>
+void run(const char * name, graph::vertex n, unsigned density, unsigned runs)
+{
+	using namespace graph;
+
+	basic_adjmatrix<Layout> g{n};
+	std::mt19937 rng{42};
+	std::uniform_int_distribution<unsigned> dist{0, 99};
+	for (vertex from = 0; from < n; ++from)
+		for (vertex to = 0; to < n; ++to)
+			if (dist(rng) < density)
+				g.add(from, to);
+
+	std::size_t sum = 0;
+	auto visitor = [&sum](auto const &, vertex v) { sum += v; };
+
+	std::cout << name << ":\n";
+	benchmark::report("breadth_first_search",
+		benchmark::measure(runs, [&] { breadth_first_search(g, 0, visitor); }));
+	benchmark::report("depth_first_search",
+		benchmark::measure(runs, [&] { depth_first_search(g, 0, visitor); }));
+	benchmark::report("count_outgoing (all vertices)", benchmark::measure(runs, [&] {
+		for (vertex v = 0; v < n; ++v)
+			sum += g.count_outgoing(v);
+	}));
+
+	if (sum == 0)
+		std::cout << "  (no edges)\n";
+}
+}
+
+int main(int argc, char ** argv)
+{
+	const graph::vertex n = (argc > 1) ? std::strtoul(argv[1], nullptr, 0) : 10000;
+	const unsigned density = (argc > 2) ? std::strtoul(argv[2], nullptr, 0) : 50;
+	const unsigned runs = 3;
+
+	std::cout << "vertices: " << n << ", density: " << density << "%\n";
+	run<graph::layout::column_major>("column_major", n, density, runs);
+	run<graph::layout::row_major>("row_major", n, density, runs);
+	run<graph::layout::blocked<64>>("blocked<64>", n, density, runs);
+
+	return 0;
+}
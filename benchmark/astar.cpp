@@ -0,0 +1,89 @@
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <graph/weighted_adjlist.hpp>
+#include <graph/path.hpp>
+#include "benchmark.hpp"
+
+// Compares Dijkstra and A* for point to point shortest path queries on a
+// grid graph with random edge weights. The heuristic of A* is the manhattan
+// distance of the grid coordinates to the destination, which is admissible
+// since all weights are at least 1. Reported are the time per query and
+// the number of vertices reached by the search.
+//
+// Usage: bench_astar [grid side]
+
+namespace
+{
+graph::weighted_adjlist<unsigned> create_grid(graph::vertex side)
+{
+	using graph::vertex;
+
+	std::mt19937 rng{42};
+	std::uniform_int_distribution<unsigned> weight{1, 10};
+
+	graph::weighted_adjlist<unsigned> g{side * side};
+	for (vertex y = 0; y < side; ++y) {
+		for (vertex x = 0; x < side; ++x) {
+			const vertex v = y * side + x;
+			if (x + 1 < side)
+				g.add({v, v + 1}, graph::edge::type::bi, weight(rng));
+			if (y + 1 < side)
+				g.add({v, v + side}, graph::edge::type::bi, weight(rng));
+		}
+	}
+	return g;
+}
+
+graph::vertex count_reached(const graph::dijkstra_workspace<unsigned> & ws)
+{
+	graph::vertex n = 0;
+	for (graph::vertex v = 0; v < ws.size(); ++v)
+		if (ws.reached(v))
+			++n;
+	return n;
+}
+}
+
+int main(int argc, char ** argv)
+{
+	using graph::vertex;
+
+	const vertex side = (argc > 1) ? std::strtoul(argv[1], nullptr, 0) : 1000;
+	const unsigned runs = 5;
+
+	const auto g = create_grid(side);
+
+	std::cout << "grid: " << side << " x " << side << ", vertices: " << g.size() << "\n";
+
+	// start in the middle of the grid, destinations along the diagonal
+	const vertex center = side / 2;
+	const vertex start = center * side + center;
+
+	graph::dijkstra_workspace<unsigned> ws{g.size()};
+	graph::vertex_list path;
+
+	for (vertex hops = 1; hops < side - center; hops *= 4) {
+		const vertex destination = start + hops * side + hops;
+		auto const manhattan = [side, destination](vertex v) -> unsigned {
+			const vertex x = v % side;
+			const vertex y = v / side;
+			const vertex dx = destination % side;
+			const vertex dy = destination / side;
+			return ((x > dx) ? x - dx : dx - x) + ((y > dy) ? y - dy : dy - y);
+		};
+
+		const std::string name = "distance " + std::to_string(2 * hops);
+		benchmark::report(name + ", dijkstra", benchmark::measure(runs, [&] {
+			graph::shortest_path_dijkstra(g, start, destination, ws, path);
+		}));
+		benchmark::report(name + ", dijkstra reached", count_reached(ws), "vertices");
+		benchmark::report(name + ", astar", benchmark::measure(runs, [&] {
+			graph::shortest_path_astar(g, start, destination, manhattan, ws, path);
+		}));
+		benchmark::report(name + ", astar reached", count_reached(ws), "vertices");
+	}
+
+	return 0;
+}
@@ -0,0 +1,39 @@
+#ifndef BENCHMARK__BENCHMARK__HPP
+#define BENCHMARK__BENCHMARK__HPP
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+
+/// Minimalistic helpers for the benchmarks, no dependencies except the
+/// standard library.
+///
+/// Benchmarks should be built with `-DCMAKE_BUILD_TYPE=Release`.
+namespace benchmark
+{
+/// Executes the specified function the specified number of times and
+/// returns the fastest run in milliseconds.
+template <class Function> double measure(unsigned runs, Function f)
+{
+	double best = std::numeric_limits<double>::max();
+	for (unsigned i = 0; i < runs; ++i) {
+		const auto t0 = std::chrono::steady_clock::now();
+		f();
+		const auto t1 = std::chrono::steady_clock::now();
+		best = std::min(best, std::chrono::duration<double, std::milli>(t1 - t0).count());
+	}
+	return best;
+}
+
+/// Prints a single result line.
+inline void report(const std::string & name, double value, const char * unit = "ms")
+{
+	std::cout << "  " << std::left << std::setw(40) << name << std::right << std::fixed
+			  << std::setprecision(3) << std::setw(12) << value << " " << unit << std::endl;
+}
+}
+
+#endif
@@ -0,0 +1,107 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <graph/bidirectional_adjlist.hpp>
+#include <graph/bfs.hpp>
+#include "benchmark.hpp"
+
+// Compares the classic breadth first search with the direction optimizing
+// one, on a graph with small diameter (random, like social networks) and on
+// one with large diameter (grid), where the search stays top down.
+
+namespace
+{
+using graph::vertex;
+
+graph::bidirectional_adjlist create_grid(vertex n)
+{
+	vertex side = 1;
+	while (side * side < n)
+		++side;
+
+	graph::bidirectional_adjlist g{side * side};
+	for (vertex y = 0; y < side; ++y) {
+		for (vertex x = 0; x < side; ++x) {
+			const vertex v = y * side + x;
+			if (x + 1 < side)
+				g.add(v, v + 1, graph::edge::type::bi);
+			if (y + 1 < side)
+				g.add(v, v + side, graph::edge::type::bi);
+		}
+	}
+	return g;
+}
+
+graph::bidirectional_adjlist create_random(vertex n, vertex degree)
+{
+	std::mt19937 rng{42};
+	std::uniform_int_distribution<vertex> random_vertex{0, n - 1};
+
+	graph::bidirectional_adjlist g{n};
+	for (vertex i = 0; i < degree * n; ++i)
+		g.add(random_vertex(rng), random_vertex(rng));
+	return g;
+}
+
+void run(const std::string & name, const graph::bidirectional_adjlist & g)
+{
+	const unsigned runs = 3;
+
+	std::cout << name << ": vertices: " << g.size() << ", edges: " << g.count_edges() << "\n";
+
+	vertex count = 0;
+	const auto count_vertex = [&count](const graph::bidirectional_adjlist &, vertex) {
+		++count;
+	};
+
+	benchmark::report("top down", benchmark::measure(runs, [&] {
+		graph::breadth_first_search(g, 0, count_vertex);
+	}));
+	benchmark::report("direction optimizing", benchmark::measure(runs, [&] {
+		graph::breadth_first_search_direction_optimizing(g, 0, count_vertex);
+	}));
+	std::cout << "  (visited: " << count / (2 * runs) << ")\n";
+}
+}
+
+int main(int argc, char ** argv)
+{
+	const vertex n = (argc > 1) ? std::strtoul(argv[1], nullptr, 0) : 1000000;
+
+	run("random", create_random(n, 16));
+	run("grid", create_grid(n));
+
+	return 0;
+}
@@ -0,0 +1,88 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <graph/adjlist.hpp>
+#include <graph/bfs.hpp>
+#include "benchmark.hpp"
+
+// Compares one breadth first search per source with the multi source
+// search, for sources spread over a random graph.
+
+namespace
+{
+using graph::vertex;
+
+graph::adjlist create_random(vertex n, vertex degree)
+{
+	std::mt19937 rng{42};
+	std::uniform_int_distribution<vertex> random_vertex{0, n - 1};
+
+	graph::adjlist g{n};
+	for (vertex i = 0; i < degree * n; ++i)
+		g.add(random_vertex(rng), random_vertex(rng));
+	return g;
+}
+}
+
+int main(int argc, char ** argv)
+{
+	const vertex n = (argc > 1) ? std::strtoul(argv[1], nullptr, 0) : 100000;
+	const vertex count = (argc > 2) ? std::strtoul(argv[2], nullptr, 0) : 256;
+	const unsigned runs = 3;
+
+	const auto g = create_random(n, 8);
+	std::cout << "random: vertices: " << g.size() << ", edges: " << g.count_edges()
+			  << ", sources: " << count << "\n";
+
+	graph::vertex_list sources;
+	for (vertex i = 0; i < count; ++i)
+		sources.push_back((i * 7919) % n);
+
+	// without depths, which would need another scan of the outgoing edges
+	std::size_t sum = 0;
+	benchmark::report("single source", benchmark::measure(runs, [&] {
+		for (auto const s : sources) {
+			graph::breadth_first_search(
+				g, s, [&sum](const graph::adjlist &, vertex) { ++sum; });
+		}
+	}));
+
+	benchmark::report("multi source", benchmark::measure(runs, [&] {
+		graph::multi_source_breadth_first_search(
+			g, sources, [&sum](std::size_t, vertex, std::size_t depth) { sum += depth; });
+	}));
+	std::cout << "  (" << sum << ")\n";
+
+	return 0;
+}
@@ -0,0 +1,90 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <graph/adjlist.hpp>
+#include <graph/bfs.hpp>
+#include <graph/bfs_parallel.hpp>
+#include "benchmark.hpp"
+
+namespace
+{
+using graph::vertex;
+
+graph::adjlist create_random(vertex n, vertex degree)
+{
+	std::mt19937 rng{42};
+	std::uniform_int_distribution<vertex> random_vertex{0, n - 1};
+
+	graph::adjlist g{n};
+	for (vertex i = 0; i < degree * n; ++i)
+		g.add(random_vertex(rng), random_vertex(rng));
+	return g;
+}
+}
+
+int main(int argc, char ** argv)
+{
+	const vertex n = (argc > 1) ? std::strtoul(argv[1], nullptr, 0) : 1000000;
+	const std::size_t max_threads = (argc > 2)
+		? std::strtoul(argv[2], nullptr, 0)
+		: std::max(1u, std::thread::hardware_concurrency());
+	const unsigned runs = 3;
+
+	const auto g = create_random(n, 16);
+	std::cout << "random: vertices: " << g.size() << ", edges: " << g.count_edges() << "\n";
+
+	benchmark::report("sequential", benchmark::measure(runs, [&] {
+		graph::breadth_first_search(g, 0, [](const graph::adjlist &, vertex) {});
+	}));
+
+	for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+		utils::thread_pool pool(threads);
+		std::atomic<vertex> count{0};
+		benchmark::report("parallel, threads: " + std::to_string(threads),
+			benchmark::measure(runs, [&] {
+				graph::breadth_first_search_parallel(
+					g, 0,
+					[&count](const graph::adjlist &, vertex) {
+						count.fetch_add(1, std::memory_order_relaxed);
+					},
+					pool);
+			}));
+	}
+
+	return 0;
+}
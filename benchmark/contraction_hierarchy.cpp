@@ -0,0 +1,86 @@
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+#include <graph/weighted_adjlist.hpp>
+#include <graph/path.hpp>
+#include <graph/contraction_hierarchy.hpp>
+#include "benchmark.hpp"
+
+// Preprocessing time, size and query time of a contraction hierarchy,
+// compared to Dijkstra, for random point to point queries on a grid graph
+// with random edge weights.
+//
+// Note: grids have no natural hierarchy (unlike road networks, with few
+// important roads), therefore they are a hard case for contraction
+// hierarchies.
+//
+// Usage: bench_contraction_hierarchy [grid side]
+
+namespace
+{
+graph::weighted_adjlist<unsigned> create_grid(graph::vertex side)
+{
+	using graph::vertex;
+
+	std::mt19937 rng{42};
+	std::uniform_int_distribution<unsigned> weight{1, 10};
+
+	graph::weighted_adjlist<unsigned> g{side * side};
+	for (vertex y = 0; y < side; ++y) {
+		for (vertex x = 0; x < side; ++x) {
+			const vertex v = y * side + x;
+			if (x + 1 < side)
+				g.add({v, v + 1}, graph::edge::type::bi, weight(rng));
+			if (y + 1 < side)
+				g.add({v, v + side}, graph::edge::type::bi, weight(rng));
+		}
+	}
+	return g;
+}
+}
+
+int main(int argc, char ** argv)
+{
+	using graph::vertex;
+
+	const vertex side = (argc > 1) ? std::strtoul(argv[1], nullptr, 0) : 200;
+	const unsigned runs = 5;
+	const unsigned queries = 1000;
+
+	const auto g = create_grid(side);
+	std::cout << "grid: " << side << " x " << side << ", vertices: " << g.size() << "\n";
+
+	std::unique_ptr<graph::contraction_hierarchy<unsigned>> ch;
+	benchmark::report("preprocessing", benchmark::measure(1, [&] {
+		ch.reset(new graph::contraction_hierarchy<unsigned>{g});
+	}));
+	std::cout << "edges: " << g.count_edges() << ", shortcuts: " << ch->count_shortcuts()
+			  << "\n";
+
+	std::mt19937 rng{7};
+	std::uniform_int_distribution<vertex> random_vertex{0, g.size() - 1};
+	std::vector<graph::edge> pairs;
+	for (unsigned i = 0; i < queries; ++i)
+		pairs.emplace_back(random_vertex(rng), random_vertex(rng));
+
+	graph::dijkstra_workspace<unsigned> forward{g.size()};
+	graph::dijkstra_workspace<unsigned> backward{g.size()};
+	graph::vertex_list path;
+
+	const double dijkstra = benchmark::measure(runs, [&] {
+		for (auto const & e : pairs)
+			graph::shortest_path_dijkstra(g, e.from, e.to, forward, path);
+	});
+	benchmark::report("dijkstra (per query)", 1000.0 * dijkstra / queries, "us");
+
+	const double hierarchy = benchmark::measure(runs, [&] {
+		for (auto const & e : pairs)
+			graph::shortest_path_contraction_hierarchy(
+				*ch, e.from, e.to, forward, backward, path);
+	});
+	benchmark::report("contraction hierarchy (per query)", 1000.0 * hierarchy / queries, "us");
+
+	return 0;
+}
@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <graph/weighted_adjlist.hpp>
+#include <graph/path.hpp>
+#include <graph/delta_stepping.hpp>
+#include "benchmark.hpp"
+
+// Single source shortest paths with delta stepping, depending on the number
+// of threads, compared to Dijkstra. Two graphs with random edge weights
+// 1..100: a grid (large diameter, many buckets) and a random graph with
+// average degree 8 (small diameter, large buckets).
+//
+// Usage: bench_delta_stepping [vertices] [max threads]
+
+namespace
+{
+using graph::vertex;
+
+graph::weighted_adjlist<unsigned> create_grid(vertex n)
+{
+	vertex side = 1;
+	while (side * side < n)
+		++side;
+
+	std::mt19937 rng{42};
+	std::uniform_int_distribution<unsigned> weight{1, 100};
+
+	graph::weighted_adjlist<unsigned> g{side * side};
+	for (vertex y = 0; y < side; ++y) {
+		for (vertex x = 0; x < side; ++x) {
+			const vertex v = y * side + x;
+			if (x + 1 < side)
+				g.add({v, v + 1}, graph::edge::type::bi, weight(rng));
+			if (y + 1 < side)
+				g.add({v, v + side}, graph::edge::type::bi, weight(rng));
+		}
+	}
+	return g;
+}
+
+graph::weighted_adjlist<unsigned> create_random(vertex n)
+{
+	std::mt19937 rng{42};
+	std::uniform_int_distribution<vertex> random_vertex{0, n - 1};
+	std::uniform_int_distribution<unsigned> weight{1, 100};
+
+	graph::weighted_adjlist<unsigned> g{n};
+	for (vertex i = 0; i < 8 * n; ++i) {
+		const graph::edge e{random_vertex(rng), random_vertex(rng)};
+		g.add(e, graph::edge::type::uni, weight(rng));
+	}
+	return g;
+}
+
+void run(const std::string & name, const graph::weighted_adjlist<unsigned> & g,
+	unsigned delta, std::size_t max_threads)
+{
+	const unsigned runs = 3;
+
+	std::cout << name << ": vertices: " << g.size() << ", edges: " << g.count_edges()
+			  << ", delta: " << delta << "\n";
+
+	benchmark::report("dijkstra", benchmark::measure(runs, [&] {
+		graph::shortest_paths_dijkstra(g, 0);
+	}));
+
+	for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+		utils::thread_pool pool(threads);
+		benchmark::report("delta stepping, threads: " + std::to_string(threads),
+			benchmark::measure(runs, [&] {
+				graph::shortest_paths_delta_stepping(g, 0, delta, pool);
+			}));
+	}
+}
+}
+
+int main(int argc, char ** argv)
+{
+	const vertex n = (argc > 1) ? std::strtoul(argv[1], nullptr, 0) : 1000000;
+	const std::size_t max_threads = (argc > 2)
+		? std::strtoul(argv[2], nullptr, 0)
+		: std::max(1u, std::thread::hardware_concurrency());
+
+	// delta: maximum weight divided by the average degree
+	run("grid", create_grid(n), 25, max_threads);
+	run("random", create_random(n), 12, max_threads);
+
+	return 0;
+}
@@ -0,0 +1,73 @@
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <graph/bidirectional_adjlist.hpp>
+#include <graph/edge_property_map.hpp>
+#include <graph/path.hpp>
+#include "benchmark.hpp"
+
+// Compares the unidirectional and the bidirectional search for point to
+// point shortest path queries, depending on the distance between start and
+// destination, on a grid graph with random edge weights. The workspaces are
+// reused, the times do not include memory allocation.
+//
+// Usage: bench_dijkstra_bidirectional [grid side]
+
+namespace
+{
+graph::bidirectional_adjlist create_grid(graph::vertex side)
+{
+	using graph::vertex;
+
+	graph::bidirectional_adjlist g{side * side};
+	for (vertex y = 0; y < side; ++y) {
+		for (vertex x = 0; x < side; ++x) {
+			const vertex v = y * side + x;
+			if (x + 1 < side)
+				g.add(v, v + 1, graph::edge::type::bi);
+			if (y + 1 < side)
+				g.add(v, v + side, graph::edge::type::bi);
+		}
+	}
+	return g;
+}
+}
+
+int main(int argc, char ** argv)
+{
+	using graph::vertex;
+
+	const vertex side = (argc > 1) ? std::strtoul(argv[1], nullptr, 0) : 1000;
+	const unsigned runs = 5;
+
+	const auto g = create_grid(side);
+	graph::edge_property_map<unsigned> p{g};
+	std::mt19937 rng{42};
+	std::uniform_int_distribution<unsigned> weight{1, 10};
+	for (std::size_t id = 0; id < p.size(); ++id)
+		p[id] = weight(rng);
+
+	std::cout << "grid: " << side << " x " << side << ", vertices: " << g.size() << "\n";
+
+	// start in the middle of the grid, destinations along the same row
+	const vertex center = side / 2;
+	const vertex start = center * side + center;
+
+	graph::dijkstra_workspace<unsigned> fw{g.size()};
+	graph::dijkstra_workspace<unsigned> bw{g.size()};
+	graph::vertex_list path;
+
+	for (vertex hops = 1; hops < side - center; hops *= 4) {
+		const vertex destination = start + hops;
+		const std::string name = "distance " + std::to_string(hops);
+		benchmark::report(name + ", unidirectional", benchmark::measure(runs, [&] {
+			graph::shortest_path_dijkstra(g, p, start, destination, fw, path);
+		}));
+		benchmark::report(name + ", bidirectional", benchmark::measure(runs, [&] {
+			graph::shortest_path_bidirectional_dijkstra(g, p, start, destination, fw, bw, path);
+		}));
+	}
+
+	return 0;
+}
@@ -0,0 +1,66 @@
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <graph/path.hpp>
+#include <graph/weighted_adjlist.hpp>
+#include "benchmark.hpp"
+
+// Measures the latency of point to point shortest path queries depending
+// on the distance between start and destination, on a grid graph with
+// random edge weights.
+//
+// Usage: bench_dijkstra_query [grid side]
+
+namespace
+{
+graph::weighted_adjlist<unsigned> create_grid(graph::vertex side)
+{
+	using graph::vertex;
+
+	graph::weighted_adjlist<unsigned> g{side * side};
+	std::mt19937 rng{42};
+	std::uniform_int_distribution<unsigned> weight{1, 10};
+	for (vertex y = 0; y < side; ++y) {
+		for (vertex x = 0; x < side; ++x) {
+			const vertex v = y * side + x;
+			if (x + 1 < side)
+				g.add(v, v + 1, graph::edge::type::bi, weight(rng));
+			if (y + 1 < side)
+				g.add(v, v + side, graph::edge::type::bi, weight(rng));
+		}
+	}
+	return g;
+}
+}
+
+int main(int argc, char ** argv)
+{
+	using graph::vertex;
+
+	const vertex side = (argc > 1) ? std::strtoul(argv[1], nullptr, 0) : 1000;
+	const unsigned runs = 5;
+	const unsigned queries = 10;
+
+	const auto g = create_grid(side);
+	std::cout << "grid: " << side << " x " << side << ", vertices: " << g.size() << "\n";
+
+	// start in the middle of the grid, destinations along the same row
+	const vertex center = side / 2;
+	const vertex start = center * side + center;
+
+	graph::dijkstra_workspace<unsigned> ws{g.size()};
+	graph::vertex_list path;
+
+	for (vertex hops = 1; hops < side - center; hops *= 4) {
+		const vertex destination = start + hops;
+		const double ms = benchmark::measure(runs, [&] {
+			for (unsigned i = 0; i < queries; ++i)
+				graph::shortest_path_dijkstra(g, start, destination, ws, path);
+		});
+		benchmark::report(
+			"distance " + std::to_string(hops) + " (per query)", 1000.0 * ms / queries, "us");
+	}
+
+	return 0;
+}
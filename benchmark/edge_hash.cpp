@@ -0,0 +1,130 @@
+#include <cstdlib>
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <graph/edge.hpp>
+#include <graph/flat_edge_map.hpp>
+#include "benchmark.hpp"
+
+// Compares lookup throughput of maps with edges as keys, on the edges
+// of a grid graph (each vertex connected to its four neighbors) and of
+// a complete graph with about the same number of edges.
+//
+// Usage: bench_edge_hash [grid side]
+//
+// The default side of 1582 results in about 10M edges.
+
+namespace
+{
+/// The former default hash, for comparison.
+struct legacy_edge_hash {
+	std::size_t operator()(const graph::edge & e) const
+	{
+		std::hash<graph::vertex> h;
+		return 0xabcdef123 + h(e.from) + (h(e.from) << 4) + (h(e.to) << 3);
+	}
+};
+
+graph::edge_list create_grid(graph::vertex side)
+{
+	using graph::vertex;
+
+	graph::edge_list edges;
+	edges.reserve(4 * side * side);
+	for (vertex y = 0; y < side; ++y) {
+		for (vertex x = 0; x < side; ++x) {
+			const vertex v = y * side + x;
+			if (x > 0)
+				edges.emplace_back(v, v - 1);
+			if (x + 1 < side)
+				edges.emplace_back(v, v + 1);
+			if (y > 0)
+				edges.emplace_back(v, v - side);
+			if (y + 1 < side)
+				edges.emplace_back(v, v + side);
+		}
+	}
+	return edges;
+}
+
+graph::edge_list create_complete(graph::vertex n)
+{
+	graph::edge_list edges;
+	edges.reserve(n * (n - 1));
+	for (graph::vertex from = 0; from < n; ++from)
+		for (graph::vertex to = 0; to < n; ++to)
+			if (from != to)
+				edges.emplace_back(from, to);
+	return edges;
+}
+
+template <class Map>
+void run(const char * name, const graph::edge_list & edges,
+	const std::vector<std::size_t> & order, unsigned runs)
+{
+	Map m;
+	m.reserve(edges.size());
+	std::cout << name << ":\n";
+	benchmark::report("insert", benchmark::measure(1, [&] {
+		for (auto const & e : edges)
+			m[e] = e.to;
+	}));
+
+	std::size_t sum = 0;
+	benchmark::report("find (all edges)", benchmark::measure(runs, [&] {
+		for (auto const & e : edges)
+			sum += m.find(e)->second;
+	}));
+	benchmark::report("find (all edges, random order)", benchmark::measure(runs, [&] {
+		for (auto const i : order)
+			sum += m.find(edges[i])->second;
+	}));
+	benchmark::report("find (missing edges)", benchmark::measure(runs, [&] {
+		for (auto const & e : edges)
+			sum += (m.find({e.from, e.from}) == m.end()); // no self loops
+	}));
+
+	if (sum == 0)
+		std::cout << "  (no edges)\n";
+}
+
+/// Runs all maps on the specified edges. The open addressing map with the
+/// legacy hash degrades to (almost) linear lookups on dense graphs and
+/// may therefore be skipped.
+void run_all(
+	const std::string & name, const graph::edge_list & edges, bool flat_legacy, unsigned runs)
+{
+	std::vector<std::size_t> order(edges.size());
+	std::iota(std::begin(order), std::end(order), 0);
+	std::shuffle(std::begin(order), std::end(order), std::mt19937{42});
+
+	std::cout << name << ", edges: " << edges.size() << "\n";
+	run<std::unordered_map<graph::edge, graph::vertex, legacy_edge_hash>>(
+		"std::unordered_map, legacy hash", edges, order, runs);
+	run<std::unordered_map<graph::edge, graph::vertex, graph::edge_hash>>(
+		"std::unordered_map, edge_hash", edges, order, runs);
+	if (flat_legacy)
+		run<graph::flat_edge_map<graph::vertex, legacy_edge_hash>>(
+			"flat_edge_map, legacy hash", edges, order, runs);
+	run<graph::flat_edge_map<graph::vertex>>("flat_edge_map", edges, order, runs);
+	std::cout << "\n";
+}
+}
+
+int main(int argc, char ** argv)
+{
+	const graph::vertex side = (argc > 1) ? std::strtoul(argv[1], nullptr, 0) : 1582;
+	const unsigned runs = 3;
+
+	const graph::vertex n = static_cast<graph::vertex>(2 * side);
+
+	run_all("grid: " + std::to_string(side) + " x " + std::to_string(side), create_grid(side),
+		true, runs);
+	run_all("complete graph: " + std::to_string(n) + " vertices", create_complete(n),
+		n <= 256, runs);
+
+	return 0;
+}
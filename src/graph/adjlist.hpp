@@ -33,12 +33,92 @@
 
 #include <algorithm>
 #include <numeric>
+#include <utility>
 #include <vector>
 #include <cassert>
 #include <graph/edge.hpp>
 
 namespace graph
 {
+/// Policies for the order of vertices within the lists of adjacency lists.
+///
+/// Each policy must provide the following static functions:
+/// - `bool contains(const vertex_list &, vertex)`
+/// - `void insert(vertex_list &, vertex)`, inserts the vertex if not already present
+/// - `void remove(vertex_list &, vertex)`
+/// - `void merge(vertex_list &, const vertex_list &)`, inserts all vertices of the
+///   second list (sorted, without duplicates) which are not already present
+namespace neighbor_order
+{
+/// Vertices are kept in the order they were added.
+///
+/// Complexity of all operations: O(d) with `d` as number of vertices in the list,
+/// except merge: O((d + k) log d) with `k` vertices to merge.
+struct insertion {
+	static bool contains(const vertex_list & l, vertex v)
+	{
+		return std::find(std::begin(l), std::end(l), v) != std::end(l);
+	}
+
+	static void insert(vertex_list & l, vertex v)
+	{
+		if (!contains(l, v))
+			l.push_back(v);
+	}
+
+	static void remove(vertex_list & l, vertex v)
+	{
+		l.erase(std::remove(std::begin(l), std::end(l), v), std::end(l));
+	}
+
+	static void merge(vertex_list & l, const vertex_list & add)
+	{
+		if (l.empty()) {
+			l.insert(std::end(l), std::begin(add), std::end(add));
+			return;
+		}
+		vertex_list present(l);
+		std::sort(std::begin(present), std::end(present));
+		for (auto const v : add)
+			if (!std::binary_search(std::begin(present), std::end(present), v))
+				l.push_back(v);
+	}
+};
+
+/// Vertices are kept in ascending order, which allows binary search.
+///
+/// Complexity: contains O(log d), insert and remove O(d) (moving elements only),
+/// merge O(d + k).
+struct sorted {
+	static bool contains(const vertex_list & l, vertex v)
+	{
+		return std::binary_search(std::begin(l), std::end(l), v);
+	}
+
+	static void insert(vertex_list & l, vertex v)
+	{
+		auto const i = std::lower_bound(std::begin(l), std::end(l), v);
+		if ((i == std::end(l)) || (*i != v))
+			l.insert(i, v);
+	}
+
+	static void remove(vertex_list & l, vertex v)
+	{
+		auto const i = std::lower_bound(std::begin(l), std::end(l), v);
+		if ((i != std::end(l)) && (*i == v))
+			l.erase(i);
+	}
+
+	static void merge(vertex_list & l, const vertex_list & add)
+	{
+		const auto mid = l.size();
+		l.insert(std::end(l), std::begin(add), std::end(add));
+		std::inplace_merge(std::begin(l), std::begin(l) + mid, std::end(l));
+		l.erase(std::unique(std::begin(l), std::end(l)), std::end(l));
+	}
+};
+}
+
 /// Represents a graph as adjacency list.
 ///
 /// Properties for vertices and/or edges are not possible.
@@ -48,8 +128,12 @@ namespace graph
 ///
 /// Hits to complexity of member functions is in the form: `O(n + m)`
 /// with `n` as number of vertices and `m` as number of edges.
+/// The complexities are given for the default order of vertices,
+/// see `neighbor_order` for others.
+///
+/// \tparam Order The order of vertices within the lists, see namespace `neighbor_order`.
 ///
-class adjlist
+template <class Order> class basic_adjlist
 {
 public:
 	using size_type = vertex;
@@ -62,32 +146,13 @@ private:
 	// container with consecutive data in memory.
 	std::vector<vertex_list> m;
 
-	/// Returns `true` if the specified vertex list contains the specified vertex.
-	static inline bool contains(const vertex_list & l, vertex v)
-	{
-		return std::find(std::begin(l), std::end(l), v) != std::end(l);
-	}
-
-	/// Appends the spcified vertex to the list, only if it is not already
-	/// in the list.
-	static inline void push_back_unique(vertex_list & l, vertex v)
-	{
-		if (!contains(l, v))
-			l.push_back(v);
-	}
-
-	static inline void remove_vertex(vertex_list & l, vertex v)
-	{
-		l.erase(std::remove(std::begin(l), std::end(l), v), std::end(l));
-	}
-
 public:
 	/// \{
 	/// Constructor to set the size of the graph and initialize it
 	/// with no edges.
 	///
 	/// \param[in] n Size of the graph.
-	adjlist(size_type n)
+	basic_adjlist(size_type n)
 		: n(n)
 		, m(n)
 	{
@@ -99,20 +164,34 @@ public:
 	///
 	/// \param[in] n Number of vertices, i.e. the size of the graph.
 	/// \param[in] edges Edges to initialize the graph with.
-	adjlist(size_type n, std::initializer_list<edge> edges)
-		: adjlist(n)
+	basic_adjlist(size_type n, std::initializer_list<edge> edges)
+		: basic_adjlist(n)
 	{
 		for (auto const & e : edges)
 			add(e);
 	}
 
-	adjlist(const adjlist &) = default;
-	adjlist(adjlist &&) = default;
+	/// Constructor which takes the number of vertices and a list of edges
+	/// to initialize the adjacency list, see add(const edge_list &, edge::type).
+	///
+	/// Complexity: O(n + m log m)
+	///
+	/// \param[in] n Number of vertices, i.e. the size of the graph.
+	/// \param[in] edges Edges to initialize the graph with.
+	/// \param[in] type Type of the edges
+	basic_adjlist(size_type n, const edge_list & edges, edge::type type = edge::type::uni)
+		: basic_adjlist(n)
+	{
+		add(edges, type);
+	}
+
+	basic_adjlist(const basic_adjlist &) = default;
+	basic_adjlist(basic_adjlist &&) = default;
 	/// \}
 
 	/// \{
-	adjlist & operator=(const adjlist &) = default;
-	adjlist & operator=(adjlist &&) = default;
+	basic_adjlist & operator=(const basic_adjlist &) = default;
+	basic_adjlist & operator=(basic_adjlist &&) = default;
 	/// \}
 
 	/// \{
@@ -129,9 +208,9 @@ public:
 	{
 		if ((e.from >= n) || (e.to >= n))
 			return false;
-		push_back_unique(m[e.from], e.to);
+		Order::insert(m[e.from], e.to);
 		if (type == edge::type::bi)
-			push_back_unique(m[e.to], e.from);
+			Order::insert(m[e.to], e.from);
 		return true;
 	}
 
@@ -140,6 +219,51 @@ public:
 	{
 		return add({from, to}, type);
 	}
+
+	/// Adds all specified edges to the graph at once.
+	///
+	/// The edges are sorted and duplicates removed in one pass, then merged
+	/// into the lists of the vertices. This is much faster than adding edges
+	/// one by one if many edges start at the same vertex. Vertices new to a
+	/// list are added in ascending order.
+	///
+	/// Complexity: O(n + m log m)
+	///
+	/// \param[in] edges The edges to add
+	/// \param[in] type Type of edges to add
+	/// \return true on success, false if at least one edge was out of range.
+	///   Edges out of range are ignored, all others are added.
+	bool add(const edge_list & edges, edge::type type = edge::type::uni)
+	{
+		bool valid = true;
+
+		// edges are not assignable, sort pairs of vertices
+		std::vector<std::pair<vertex, vertex>> pairs;
+		pairs.reserve((type == edge::type::bi) ? 2 * edges.size() : edges.size());
+		for (auto const & e : edges) {
+			if ((e.from >= n) || (e.to >= n)) {
+				valid = false;
+				continue;
+			}
+			pairs.emplace_back(e.from, e.to);
+			if (type == edge::type::bi)
+				pairs.emplace_back(e.to, e.from);
+		}
+		std::sort(std::begin(pairs), std::end(pairs));
+		pairs.erase(std::unique(std::begin(pairs), std::end(pairs)), std::end(pairs));
+
+		// merge groups of edges with the same starting vertex
+		vertex_list to;
+		for (auto i = std::begin(pairs); i != std::end(pairs);) {
+			const vertex from = i->first;
+			to.clear();
+			for (; (i != std::end(pairs)) && (i->first == from); ++i)
+				to.push_back(i->second);
+			Order::merge(m[from], to);
+		}
+
+		return valid;
+	}
 	/// \}
 
 	/// \{
@@ -156,9 +280,9 @@ public:
 	{
 		if ((e.from >= n) || (e.to >= n))
 			return false;
-		remove_vertex(m[e.from], e.to);
+		Order::remove(m[e.from], e.to);
 		if (type == edge::type::bi)
-			remove_vertex(m[e.to], e.from);
+			Order::remove(m[e.to], e.from);
 		return true;
 	}
 
@@ -173,7 +297,7 @@ public:
 	/// to the graph and is not boundary checked.
 	///
 	/// Complexity: O(m)
-	bool at(edge e) const { return contains(m[e.from], e.to); }
+	bool at(edge e) const { return Order::contains(m[e.from], e.to); }
 
 	/// Convenience function. See \see at(edge) const
 	bool at(vertex from, vertex to) const { return at({from, to}); }
@@ -205,8 +329,8 @@ public:
 	{
 		if (to >= n)
 			return 0;
-		return std::count_if(
-			std::begin(m), std::end(m), [to](const auto & v) { return contains(v, to); });
+		return std::count_if(std::begin(m), std::end(m),
+			[to](const auto & v) { return Order::contains(v, to); });
 	}
 
 	/// Returns a list of nodes from where an edge exists.
@@ -220,7 +344,7 @@ public:
 		if (to >= n)
 			return v;
 		for (vertex i = 0; i < n; ++i)
-			if (contains(m[i], to))
+			if (Order::contains(m[i], to))
 				v.push_back(i);
 		return v;
 	}
@@ -270,6 +394,12 @@ public:
 	}
 	/// \}
 };
+
+/// Adjacency list, vertices in the order they were added.
+using adjlist = basic_adjlist<neighbor_order::insertion>;
+
+/// Adjacency list, vertices in ascending order.
+using sorted_adjlist = basic_adjlist<neighbor_order::sorted>;
 }
 
 #endif
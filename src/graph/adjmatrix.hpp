@@ -39,6 +39,60 @@
 
 namespace graph
 {
+/// Policies for the storage layout of adjacency matrices.
+///
+/// A layout maps an edge to the index within the container of the matrix.
+/// Each layout must provide:
+/// - `static std::size_t storage_size(std::size_t n)` which returns the number
+///   of cells necessary for a matrix of `n` vertices.
+/// - `static std::size_t index(edge e, std::size_t n)` which returns the index
+///   of the specified edge.
+namespace layout
+{
+/// Stores the matrix row by row, all outgoing edges of a vertex are consecutive
+/// in memory. This is the most cache friendly layout for the algorithms, because
+/// they mostly iterate over outgoing edges.
+struct row_major {
+	static constexpr std::size_t storage_size(std::size_t n) noexcept { return n * n; }
+	static constexpr std::size_t index(edge e, std::size_t n) noexcept
+	{
+		return e.from * n + e.to;
+	}
+};
+
+/// Stores the matrix column by column, all incoming edges of a vertex are
+/// consecutive in memory.
+struct column_major {
+	static constexpr std::size_t storage_size(std::size_t n) noexcept { return n * n; }
+	static constexpr std::size_t index(edge e, std::size_t n) noexcept
+	{
+		return e.from + e.to * n;
+	}
+};
+
+/// Stores the matrix in square tiles of `B` by `B` cells, the tiles as well as
+/// the cells within the tiles are stored row by row. The matrix is padded to
+/// a multiple of `B`.
+///
+/// This keeps outgoing as well as incoming edges of a vertex reasonably close
+/// in memory.
+template <std::size_t B = 64> struct blocked {
+	static_assert(B > 0, "block size must not be zero");
+
+	static constexpr std::size_t blocks(std::size_t n) noexcept { return (n + B - 1) / B; }
+
+	static constexpr std::size_t storage_size(std::size_t n) noexcept
+	{
+		return blocks(n) * blocks(n) * B * B;
+	}
+
+	static constexpr std::size_t index(edge e, std::size_t n) noexcept
+	{
+		return ((e.from / B) * blocks(n) + (e.to / B)) * B * B + (e.from % B) * B + (e.to % B);
+	}
+};
+}
+
 /// This class represents a graph, implemented as adjacency matrix
 /// and provides simple accessors to the graph.
 /// It is possible to add unidirectional edges, but they get treated
@@ -49,7 +103,9 @@ namespace graph
 /// Once constructed, the size is constant. It is not possible to
 /// grow or shrink.
 ///
-class adjmatrix
+/// \tparam Layout The storage layout of the matrix, see namespace `layout`.
+///
+template <class Layout> class basic_adjmatrix
 {
 public:
 	using size_type = vertex;
@@ -72,7 +128,7 @@ private:
 
 	/// Computes the index of the specified edge within the adjacency matrix,
 	/// which is implemented as std::vector.
-	vertex edge_index(edge e) const noexcept { return e.from + e.to * n; }
+	vertex edge_index(edge e) const noexcept { return Layout::index(e, n); }
 
 public:
 	/// \{
@@ -80,28 +136,28 @@ public:
 	/// with no edges.
 	///
 	/// \param[in] n Size of the matrix.
-	adjmatrix(size_type n)
+	basic_adjmatrix(size_type n)
 		: n(n)
-		, m(n * n, no_value)
+		, m(Layout::storage_size(n), no_value)
 	{
 		assert(n > 0);
 	}
 
-	adjmatrix(size_type n, std::initializer_list<edge> edges)
-		: adjmatrix(n)
+	basic_adjmatrix(size_type n, std::initializer_list<edge> edges)
+		: basic_adjmatrix(n)
 	{
 		assert(n > 0);
 		for (auto const & e : edges)
 			add(e);
 	}
 
-	adjmatrix(const adjmatrix &) = default;
-	adjmatrix(adjmatrix &&) = default;
+	basic_adjmatrix(const basic_adjmatrix &) = default;
+	basic_adjmatrix(basic_adjmatrix &&) = default;
 	/// \}
 
 	/// \{
-	adjmatrix & operator=(const adjmatrix &) = default;
-	adjmatrix & operator=(adjmatrix &&) = default;
+	basic_adjmatrix & operator=(const basic_adjmatrix &) = default;
+	basic_adjmatrix & operator=(basic_adjmatrix &&) = default;
 	/// \}
 
 	/// \{
@@ -290,6 +346,9 @@ public:
 	}
 	/// \}
 };
+
+/// Adjacency matrix with the default layout.
+using adjmatrix = basic_adjmatrix<layout::column_major>;
 }
 
 #endif
@@ -31,67 +31,429 @@
 #ifndef GRAPH__BFS__HPP
 #define GRAPH__BFS__HPP
 
-#include <queue>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
 #include <graph/type_traits.hpp>
+#include <graph/neighbors.hpp>
 #include <graph/edge.hpp>
+#include <graph/visit.hpp>
+#include <graph/visited_set.hpp>
+#include <utils/bits.hpp>
 
 namespace graph
 {
+/// State of breadth_first_search(). May be provided by the caller to avoid
+/// allocations for repeated searches.
+struct bfs_workspace {
+	visited_set visited; ///< The vertices found by the search.
+	vertex_list queue; ///< The vertices found by the search, in the order of finding.
+
+	/// Prepares the workspace for a search on a graph of the specified size.
+	/// Allocated memory is kept.
+	void reset(std::size_t n)
+	{
+		visited.reset(n);
+		queue.clear();
+	}
+};
+
 /// This algorithm searches the graph and calls the visitor for each
 /// vertex. The strategy is 'breadth first'.
 ///
+/// Complexity: O(n + m) for graphs with cheap access to outgoing vertices
+///   (`outgoing(vertex)` returning a reference or view, or `for_each_outgoing`),
+///   O(n^2) for matrix like graphs.
+///
 /// \tparam Graph The graph type to visit.
 ///   Must provide the following features:
 ///   - type 'size_type'
-///   - type 'value_type'
 ///   - function `size_type size() const` which returns the number of nodes in the graph
-///   - function `integral_type at(edge) const` which returns the status of the specified edge.
-///     integral types can implictly converted to `bool`, which is in fact a hard
-///     requirement.
+///   - at least one of the following:
+///     - function `void for_each_outgoing(vertex, Function) const`
+///     - function `outgoing(vertex) const` which returns the outgoing vertices
+///     - function `integral_type at(edge) const` which returns the status of the specified
+///       edge. integral types can implictly converted to `bool`, which is in fact a hard
+///       requirement.
 /// \tparam Visitor The visitor type. Must provide the ability to get called
 ///   with a signature like `(Graph, vertex)`, e.g. `void visitor(const Graph &, vertex v)`.
+///   The visitor may return a `visit_result` to control the search: `skip` does
+///   not search the outgoing vertices of the visited one (they may still be found
+///   via other vertices), `stop` ends the search, e.g. when a target is found.
 ///
 /// \param[in] g The adjacency matrix to visit.
 /// \param[in] v The starting vertex.
 /// \param[in] visitor Visitor which gets called for each found vertex.
+/// \param[in,out] ws The state of the search. Its contents are overwritten, it may
+///   be reused for repeated searches to avoid allocations. Afterwards it contains
+///   the vertices found, including the ones queued but not visited if the search
+///   was stopped.
 /// \return The visitor functor
 ///
 template <class Graph, class Visitor,
-	typename = typename std::enable_if<detail::has_t_size_type<Graph>::value
-			&& detail::has_f_size<Graph>::value && detail::has_f_integral_type_at<Graph>::value,
-		void>::type>
-Visitor breadth_first_search(const Graph & g, vertex v, Visitor visitor)
+	typename = typename std::enable_if<detail::is_traversable<Graph>::value, void>::type>
+Visitor breadth_first_search(const Graph & g, vertex v, Visitor visitor, bfs_workspace & ws)
 {
+	ws.reset(g.size());
 	if (v >= g.size())
 		return visitor;
 
-	std::queue<vertex> q;
-	visited_vertex_list gray(g.size(), false);
-	visited_vertex_list black(g.size(), false);
+	// each vertex is queued at most once, vertices are not removed from the queue
+	auto & q = ws.queue;
+	std::size_t head = 0;
 
-	// starting vertex is gray and put into queue
-	gray[v] = true;
-	q.push(v);
+	// starting vertex is found and put into queue
+	ws.visited.set(v);
+	q.push_back(v);
 
-	while (q.size() > 0) {
+	while (head < q.size()) {
 		// remove first in queue
-		vertex u = q.front();
-		q.pop();
-
-		// all white successors of u
-		for (vertex i = 0; i < g.size(); ++i) {
-			if (!gray[i] && !black[i] && g.at({u, i})) {
-				gray[i] = true;
-				q.push(i);
+		const vertex u = q[head++];
+
+		// visit vertex
+		const auto result = detail::visit(visitor, g, u);
+		if (result == visit_result::stop)
+			break;
+		if (result == visit_result::skip)
+			continue;
+
+		// all successors of u not found yet
+		detail::for_each_outgoing(g, u, [&](vertex i) {
+			if (!ws.visited.test_and_set(i))
+				q.push_back(i);
+		});
+	}
+	return visitor;
+}
+
+/// Searches the graph breadth first.
+///
+/// Allocates the state of the search on every call.
+///
+/// \see breadth_first_search(const Graph &, vertex, Visitor, bfs_workspace &)
+///
+template <class Graph, class Visitor,
+	typename = typename std::enable_if<detail::is_traversable<Graph>::value, void>::type>
+Visitor breadth_first_search(const Graph & g, vertex v, Visitor visitor)
+{
+	bfs_workspace ws;
+	return breadth_first_search(g, v, std::move(visitor), ws);
+}
+
+/// Result of a breadth first search: the depth (number of edges from the
+/// start) and the parent (predecessor within the tree of the search) of
+/// each vertex.
+struct breadth_first_tree {
+	/// Depth of vertices which are not reachable from the start.
+	enum : std::size_t { unreachable = std::numeric_limits<std::size_t>::max() };
+
+	/// The start vertex of the search.
+	vertex start = vertex_invalid;
+
+	/// Depth of each vertex, `unreachable` if not reachable.
+	std::vector<std::size_t> depth;
+
+	/// Parent of each vertex, `vertex_invalid` for the start and for
+	/// vertices not reachable.
+	vertex_list parent;
+
+	/// Returns true if the specified vertex is reachable from the start.
+	bool reachable(vertex v) const { return (v < depth.size()) && (depth[v] != unreachable); }
+
+	/// Returns the path from the start to the specified vertex (inclusive),
+	/// or an empty list if the vertex is not reachable.
+	///
+	/// Complexity: O(length of the path)
+	vertex_list path(vertex destination) const
+	{
+		vertex_list v;
+		if (!reachable(destination))
+			return v;
+		for (vertex u = destination; u != vertex_invalid; u = parent[u])
+			v.push_back(u);
+		std::reverse(std::begin(v), std::end(v));
+		return v;
+	}
+};
+
+/// \cond DEV
+namespace detail
+{
+/// Tuning of breadth_first_search_direction_optimizing(), the values proposed
+/// by Beamer et al. The search switches to bottom up if the frontier has more
+/// than `1 / alpha` of the edges of the unvisited vertices, and back to top
+/// down if the frontier has less than `1 / beta` of the vertices.
+enum : std::size_t { bfs_alpha = 14, bfs_beta = 24 };
+}
+/// \endcond
+
+/// Searches the graph breadth first, like breadth_first_search(), switching
+/// between two strategies depending on the size of the frontier (direction
+/// optimizing, Beamer et al.):
+///
+/// - top down: the outgoing edges of all vertices of the frontier are
+///   checked for unvisited vertices. This is the classic breadth first search,
+///   efficient for small frontiers.
+/// - bottom up: the incoming edges of all unvisited vertices are checked for
+///   a vertex of the frontier, the check of a vertex stops at the first hit.
+///   For large frontiers, which contain most of the vertices, this checks
+///   only a fraction of the edges. The frontier is stored as bitmap.
+///
+/// Graphs with a small diameter (e.g. social networks) have few, very large
+/// levels, for which the search checks far fewer edges than the top down search.
+///
+/// The visitor is called for each reachable vertex, level by level: all
+/// vertices of a depth are visited before the ones of the next depth. The
+/// order within a level is not specified.
+///
+/// Complexity: O(n + m) for graphs with cheap access to outgoing and incoming
+///   vertices (like `bidirectional_adjlist`), plus O(n) per level searched
+///   bottom up.
+///
+/// \tparam Graph The graph type to visit.
+///   Must provide the features listed for breadth_first_search() and:
+///   - function `size_type count_outgoing(vertex) const` which returns the number of
+///     outgoing edges of a vertex
+///   - function `vertex_list incoming(vertex) const` which returns a `vertex_list` of all
+///     vertices with an edge to the specified one
+/// \tparam Visitor The visitor type, see breadth_first_search()
+///
+/// \param[in] g The graph to visit.
+/// \param[in] v The starting vertex.
+/// \param[in] visitor Visitor which gets called for each found vertex.
+/// \return The depth and parent of all vertices. If the starting vertex is
+///   invalid, the containers of the result are empty.
+///
+template <class Graph, class Visitor,
+	typename = typename std::enable_if<detail::is_traversable<Graph>::value
+			&& detail::has_f_count_outgoing<Graph>::value
+			&& detail::has_f_incoming<Graph>::value,
+		void>::type>
+breadth_first_tree breadth_first_search_direction_optimizing(
+	const Graph & g, vertex v, Visitor && visitor)
+{
+	using utils::word;
+	using utils::word_bits;
+	constexpr auto unreachable = breadth_first_tree::unreachable;
+
+	breadth_first_tree tree;
+	if (v >= g.size())
+		return tree;
+
+	const vertex n = g.size();
+	tree.start = v;
+	tree.depth.assign(n, unreachable);
+	tree.parent.assign(n, vertex_invalid);
+	auto & depth = tree.depth;
+	auto & parent = tree.parent;
+
+	// frontier as list (top down) or as bitmap (bottom up)
+	vertex_list frontier{v};
+	vertex_list next;
+	std::vector<word> frontier_bits;
+	std::vector<word> next_bits;
+	bool bottom_up = false;
+
+	auto const test = [](const std::vector<word> & bits, vertex u) {
+		return (bits[u / word_bits] >> (u % word_bits)) & 1u;
+	};
+	auto const set = [](std::vector<word> & bits, vertex u) {
+		bits[u / word_bits] |= word{1} << (u % word_bits);
+	};
+	auto const for_each_set = [](const std::vector<word> & bits, auto f) {
+		for (std::size_t i = 0; i < bits.size(); ++i)
+			utils::for_each_bit(bits[i], [&](unsigned b) { f(i * word_bits + b); });
+	};
+
+	std::size_t edges_unvisited = 0;
+	for (vertex u = 0; u < n; ++u)
+		edges_unvisited += g.count_outgoing(u);
+	std::size_t edges_frontier = g.count_outgoing(v);
+	std::size_t size_frontier = 1;
+
+	depth[v] = 0;
+	for (std::size_t level = 0; size_frontier > 0; ++level) {
+		edges_unvisited -= edges_frontier;
+
+		if (bottom_up) {
+			for_each_set(frontier_bits, [&](vertex u) { visitor(g, u); });
+		} else {
+			for (auto const u : frontier)
+				visitor(g, u);
+		}
+
+		// choose the direction of the next step
+		if (!bottom_up && (edges_frontier > edges_unvisited / detail::bfs_alpha)) {
+			frontier_bits.assign(utils::words_for_bits(n), 0);
+			for (auto const u : frontier)
+				set(frontier_bits, u);
+			bottom_up = true;
+		} else if (bottom_up && (size_frontier < n / detail::bfs_beta)) {
+			frontier.clear();
+			for_each_set(frontier_bits, [&](vertex u) { frontier.push_back(u); });
+			bottom_up = false;
+		}
+
+		edges_frontier = 0;
+		size_frontier = 0;
+		if (bottom_up) {
+			next_bits.assign(utils::words_for_bits(n), 0);
+			for (vertex w = 0; w < n; ++w) {
+				if (depth[w] != unreachable)
+					continue;
+				for (auto const u : g.incoming(w)) {
+					if (test(frontier_bits, u)) {
+						depth[w] = level + 1;
+						parent[w] = u;
+						set(next_bits, w);
+						++size_frontier;
+						edges_frontier += g.count_outgoing(w);
+						break;
+					}
+				}
 			}
+			std::swap(frontier_bits, next_bits);
+		} else {
+			next.clear();
+			for (auto const u : frontier) {
+				detail::for_each_outgoing(g, u, [&](vertex w) {
+					if (depth[w] == unreachable) {
+						depth[w] = level + 1;
+						parent[w] = u;
+						next.push_back(w);
+						edges_frontier += g.count_outgoing(w);
+					}
+				});
+			}
+			size_frontier = next.size();
+			std::swap(frontier, next);
 		}
+	}
+	return tree;
+}
 
-		// visit and mark vertex
-		black[u] = true;
-		visitor(g, u);
+/// Searches the graph breadth first, switching between top down and bottom up,
+/// without visitor.
+///
+/// \see breadth_first_search_direction_optimizing(const Graph &, vertex, Visitor &&)
+///
+template <class Graph,
+	typename = typename std::enable_if<detail::is_traversable<Graph>::value
+			&& detail::has_f_count_outgoing<Graph>::value
+			&& detail::has_f_incoming<Graph>::value,
+		void>::type>
+breadth_first_tree breadth_first_search_direction_optimizing(const Graph & g, vertex v)
+{
+	return breadth_first_search_direction_optimizing(g, v, [](const Graph &, vertex) {});
+}
+
+/// Searches the graph breadth first from many sources at once (multi source
+/// breadth first search, Then et al.).
+///
+/// Up to 64 searches run together, one per bit of a word kept for each
+/// vertex: the sources which have seen the vertex, the ones for which it
+/// is in the current frontier, and the ones for which it is in the next.
+/// The outgoing edges of a vertex are scanned once per level for all
+/// searches having it in their frontier. More sources are processed in
+/// batches of 64.
+///
+/// For many sources in a graph with small diameter, where the searches
+/// overlap, this is much faster than one breadth_first_search() per source.
+///
+/// The visitor is called with the index of the source (in `sources`), the
+/// found vertex and its depth (number of edges from the source), once for
+/// each pair of source and vertex reachable from it. All vertices of a depth
+/// are visited before the ones of the next depth within a batch of sources.
+/// Invalid sources do not find any vertex.
+///
+/// Complexity: O(b * (d * n + m)) for graphs with cheap access to outgoing
+///   vertices, with `b` the number of batches and `d` the largest depth found
+///
+/// \tparam Graph The graph type to visit, see breadth_first_search()
+/// \tparam Visitor The visitor type. Must provide the ability to get called
+///   with `(std::size_t source, vertex v, std::size_t depth)`.
+///
+/// \param[in] g The graph to visit.
+/// \param[in] sources The starting vertices.
+/// \param[in] visitor Visitor which gets called for each found pair of source and vertex.
+/// \return The visitor functor
+///
+template <class Graph, class Visitor,
+	typename = typename std::enable_if<detail::is_traversable<Graph>::value, void>::type>
+Visitor multi_source_breadth_first_search(
+	const Graph & g, const vertex_list & sources, Visitor visitor)
+{
+	using utils::word;
+	using utils::word_bits;
+
+	const vertex n = g.size();
+	std::vector<word> seen;
+	std::vector<word> visit;
+	std::vector<word> next;
+
+	for (std::size_t batch = 0; batch < sources.size(); batch += word_bits) {
+		const std::size_t count = std::min<std::size_t>(word_bits, sources.size() - batch);
+
+		seen.assign(n, 0);
+		visit.assign(n, 0);
+		next.assign(n, 0);
+
+		bool active = false;
+		for (std::size_t i = 0; i < count; ++i) {
+			const vertex s = sources[batch + i];
+			if (s >= n)
+				continue;
+			seen[s] |= word{1} << i;
+			visit[s] |= word{1} << i;
+			visitor(batch + i, s, std::size_t{0});
+			active = true;
+		}
+
+		for (std::size_t depth = 1; active; ++depth) {
+			for (vertex u = 0; u < n; ++u) {
+				const word w = visit[u];
+				if (!w)
+					continue;
+				detail::for_each_outgoing(g, u, [&](vertex v) { next[v] |= w; });
+			}
+
+			active = false;
+			for (vertex v = 0; v < n; ++v) {
+				const word w = next[v] & ~seen[v];
+				next[v] = 0;
+				visit[v] = w;
+				if (!w)
+					continue;
+				seen[v] |= w;
+				active = true;
+				utils::for_each_bit(w, [&](unsigned i) { visitor(batch + i, v, depth); });
+			}
+		}
 	}
 	return visitor;
 }
+
+/// Searches the graph breadth first from many sources at once and returns
+/// the depths.
+///
+/// \see multi_source_breadth_first_search(const Graph &, const vertex_list &, Visitor)
+///
+/// \return The depth of all vertices (`breadth_first_tree::unreachable` if
+///   not reachable), for each source. For invalid sources all vertices are
+///   unreachable.
+///
+template <class Graph,
+	typename = typename std::enable_if<detail::is_traversable<Graph>::value, void>::type>
+std::vector<std::vector<std::size_t>> multi_source_breadth_first_search(
+	const Graph & g, const vertex_list & sources)
+{
+	std::vector<std::vector<std::size_t>> depth(
+		sources.size(), std::vector<std::size_t>(g.size(), breadth_first_tree::unreachable));
+	multi_source_breadth_first_search(g, sources,
+		[&depth](std::size_t source, vertex v, std::size_t d) { depth[source][v] = d; });
+	return depth;
+}
 }
 
 #endif
@@ -0,0 +1,179 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef GRAPH__BFS_PARALLEL__HPP
+#define GRAPH__BFS_PARALLEL__HPP
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include <graph/type_traits.hpp>
+#include <graph/neighbors.hpp>
+#include <graph/edge.hpp>
+#include <graph/bfs.hpp>
+#include <utils/thread_pool.hpp>
+
+namespace graph
+{
+/// \cond DEV
+namespace detail
+{
+/// Number of frontier vertices a thread of breadth_first_search_parallel()
+/// takes at once. Small enough to balance vertices of different degree,
+/// large enough to keep the contention on the shared counter low.
+enum : std::size_t { bfs_parallel_chunk = 64 };
+}
+/// \endcond
+
+/// Searches the graph breadth first, level by level, in parallel.
+///
+/// All threads of the pool process the frontier (the vertices of the current
+/// level) together, taking chunks of vertices from it. A thread claims an
+/// unvisited vertex by setting its parent atomically (compare and swap),
+/// only the claiming thread adds the vertex to its own part of the next
+/// frontier. The parts are joined after each level.
+///
+/// The visitor is called for each reachable vertex exactly once, level by
+/// level: all vertices of a depth are visited before the ones of the next
+/// depth. The order within a level is not specified. **The visitor is called
+/// concurrently** from all threads of the pool, it must be safe to do so
+/// (e.g. use atomic counters or a mutex).
+///
+/// The threads synchronize twice per level, graphs with a large diameter
+/// relative to their size (e.g. grids, road networks) profit little.
+///
+/// Complexity: O(n + m) for graphs with cheap access to outgoing vertices,
+///   work distributed to the threads of the pool.
+///
+/// \tparam Graph The graph type to visit, see breadth_first_search().
+///   Concurrent reads of the graph must be safe.
+/// \tparam Visitor The visitor type, see breadth_first_search()
+///
+/// \param[in] g The graph to visit, must not be modified during the call
+/// \param[in] v The starting vertex.
+/// \param[in] visitor Visitor which gets called for each found vertex.
+/// \param[in] pool The threads to run the search
+/// \return The depth and parent of all vertices. If the starting vertex is
+///   invalid, the containers of the result are empty.
+///
+template <class Graph, class Visitor,
+	typename = typename std::enable_if<detail::is_traversable<Graph>::value, void>::type>
+breadth_first_tree breadth_first_search_parallel(
+	const Graph & g, vertex v, Visitor && visitor, utils::thread_pool & pool)
+{
+	breadth_first_tree tree;
+	if (v >= g.size())
+		return tree;
+
+	const vertex n = g.size();
+	const std::size_t threads = pool.size();
+
+	tree.start = v;
+	tree.depth.assign(n, breadth_first_tree::unreachable);
+	auto & depth = tree.depth;
+
+	// the parent marks a vertex as visited, the start is its own parent during the search
+	std::vector<std::atomic<vertex>> parent(n);
+	for (auto & p : parent)
+		p.store(vertex_invalid, std::memory_order_relaxed);
+	parent[v].store(v, std::memory_order_relaxed);
+	depth[v] = 0;
+
+	vertex_list frontier{v};
+	std::vector<vertex_list> next(threads); // next frontier, by thread
+	std::vector<std::size_t> offset(threads + 1);
+	std::atomic<std::size_t> position{0};
+	std::size_t level = 0;
+
+	auto const expand = [&](std::size_t t) {
+		auto & local = next[t];
+		local.clear();
+		for (;;) {
+			const std::size_t begin
+				= position.fetch_add(detail::bfs_parallel_chunk, std::memory_order_relaxed);
+			if (begin >= frontier.size())
+				break;
+			const std::size_t end
+				= std::min(begin + detail::bfs_parallel_chunk, frontier.size());
+			for (std::size_t i = begin; i < end; ++i) {
+				const vertex u = frontier[i];
+				visitor(g, u);
+				detail::for_each_outgoing(g, u, [&](vertex w) {
+					if (parent[w].load(std::memory_order_relaxed) != vertex_invalid)
+						return;
+					vertex expected = vertex_invalid;
+					if (parent[w].compare_exchange_strong(
+							expected, u, std::memory_order_relaxed)) {
+						depth[w] = level + 1;
+						local.push_back(w);
+					}
+				});
+			}
+		}
+	};
+
+	auto const join = [&](std::size_t t) {
+		std::copy(std::begin(next[t]), std::end(next[t]),
+			std::begin(frontier) + static_cast<std::ptrdiff_t>(offset[t]));
+	};
+
+	while (!frontier.empty()) {
+		position.store(0, std::memory_order_relaxed);
+		pool.run(expand);
+
+		for (std::size_t t = 0; t < threads; ++t)
+			offset[t + 1] = offset[t] + next[t].size();
+		frontier.resize(offset[threads]);
+		pool.run(join);
+		++level;
+	}
+
+	tree.parent.resize(n);
+	for (vertex u = 0; u < n; ++u)
+		tree.parent[u] = parent[u].load(std::memory_order_relaxed);
+	tree.parent[v] = vertex_invalid;
+	return tree;
+}
+
+/// Searches the graph breadth first in parallel, without visitor.
+///
+/// \see breadth_first_search_parallel(const Graph &, vertex, Visitor &&, thread_pool &)
+///
+template <class Graph,
+	typename = typename std::enable_if<detail::is_traversable<Graph>::value, void>::type>
+breadth_first_tree breadth_first_search_parallel(
+	const Graph & g, vertex v, utils::thread_pool & pool)
+{
+	return breadth_first_search_parallel(g, v, [](const Graph &, vertex) {}, pool);
+}
+}
+
+#endif
@@ -0,0 +1,213 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef GRAPH__BIDIRECTIONAL_ADJLIST__HPP
+#define GRAPH__BIDIRECTIONAL_ADJLIST__HPP
+
+#include <graph/adjlist.hpp>
+
+namespace graph
+{
+/// Represents a graph as adjacency list, keeping track of outgoing as
+/// well as of incoming edges.
+///
+/// In addition to the adjacency list of `adjlist`, the transposed adjacency
+/// list is maintained, which makes access to incoming edges as cheap as
+/// the access to outgoing edges. The price is twice the memory for the
+/// edges and twice the work to add or remove edges.
+///
+/// Properties for vertices and/or edges are not possible.
+///
+/// Once constructed, the size is constant. It is not possible to
+/// grow or shrink.
+///
+/// Hits to complexity of member functions is in the form: `O(n + m)`
+/// with `n` as number of vertices and `m` as number of edges.
+///
+class bidirectional_adjlist
+{
+public:
+	using size_type = adjlist::size_type;
+
+private:
+	adjlist out; // outgoing edges
+	adjlist in; // incoming edges, transposed graph
+
+public:
+	/// \{
+	/// Constructor to set the size of the graph and initialize it
+	/// with no edges.
+	///
+	/// \param[in] n Size of the graph.
+	bidirectional_adjlist(size_type n)
+		: out(n)
+		, in(n)
+	{
+	}
+
+	/// Constructor which takes the number of vertices and an initializer list
+	/// of edges to initialize the adjacency list.
+	///
+	/// \param[in] n Number of vertices, i.e. the size of the graph.
+	/// \param[in] edges Edges to initialize the graph with.
+	bidirectional_adjlist(size_type n, std::initializer_list<edge> edges)
+		: bidirectional_adjlist(n)
+	{
+		for (auto const & e : edges)
+			add(e);
+	}
+
+	bidirectional_adjlist(const bidirectional_adjlist &) = default;
+	bidirectional_adjlist(bidirectional_adjlist &&) = default;
+	/// \}
+
+	/// \{
+	bidirectional_adjlist & operator=(const bidirectional_adjlist &) = default;
+	bidirectional_adjlist & operator=(bidirectional_adjlist &&) = default;
+	/// \}
+
+	/// \{
+	/// Adds an edge to the graph.
+	///
+	/// Complexity: O(m)
+	///
+	/// \param[in] e The edge to add
+	/// \param[in] type Type of edge to add
+	/// \return true on success, false otherwise
+	///
+	/// \note This function performs boundary check.
+	bool add(edge e, edge::type type = edge::type::uni)
+	{
+		if (!out.add(e, type))
+			return false;
+		in.add(e.reverse(), type);
+		return true;
+	}
+
+	/// \see add()
+	bool add(vertex from, vertex to, edge::type type = edge::type::uni)
+	{
+		return add({from, to}, type);
+	}
+	/// \}
+
+	/// \{
+	/// Removes an edge from the graph.
+	///
+	/// Complexity: O(m)
+	///
+	/// \param[in] e Edge to remove
+	/// \param[in] type Type of edge to add
+	/// \return true on success, false otherwise
+	///
+	/// \note This function performs boundary check.
+	bool remove(edge e, edge::type type = edge::type::uni)
+	{
+		if (!out.remove(e, type))
+			return false;
+		in.remove(e.reverse(), type);
+		return true;
+	}
+
+	/// \see remove()
+	bool remove(vertex from, vertex to, edge::type type = edge::type::uni)
+	{
+		return remove({from, to}, type);
+	}
+	/// \}
+
+	/// \{
+	/// Accessor for edges. This method provides read only access
+	/// to the graph and is not boundary checked.
+	///
+	/// Complexity: O(m)
+	bool at(edge e) const { return out.at(e); }
+
+	/// Convenience function. See \see at(edge) const
+	bool at(vertex from, vertex to) const { return at({from, to}); }
+
+	/// Accessor for edges, uses index operator.
+	bool operator[](edge e) const { return at(e); }
+	/// \}
+
+	/// \{
+	/// Returns the size of the graph (number of vertices).
+	size_type size() const noexcept { return out.size(); }
+
+	/// Returns a list of vertices. This function is for convinience only.
+	///
+	/// Complexity: O(n)
+	vertex_list vertices() const { return out.vertices(); }
+
+	/// Returns the number of incoming edges to the specified vertex.
+	///
+	/// If the specified vertex is invalid the function returns 0.
+	///
+	/// Complexity: O(1)
+	size_type count_incoming(vertex to) const { return in.count_outgoing(to); }
+
+	/// Returns a list of nodes from where an edge exists.
+	///
+	/// This function is not boundary checked.
+	///
+	/// Complexity: O(1)
+	const vertex_list & incoming(vertex to) const { return in.outgoing(to); }
+
+	/// Returns the number of outgoing edges of the specified vertex.
+	///
+	/// If the specified vertex is invalid the function returns 0.
+	///
+	/// Complexity: O(1)
+	size_type count_outgoing(vertex from) const { return out.count_outgoing(from); }
+
+	/// Returns a list of nodes to where an edge exists.
+	///
+	/// This function is not boundary checked.
+	///
+	/// Complexity: O(1)
+	const vertex_list & outgoing(vertex from) const { return out.outgoing(from); }
+	/// \}
+
+	/// \{
+	/// Returns the total number of edges within the graph.
+	///
+	/// Complexity: O(n)
+	size_type count_edges() const noexcept { return out.count_edges(); }
+
+	/// Returns a list of edges defined by the graph.
+	///
+	/// Complexity: O(n + m)
+	edge_list edges() const { return out.edges(); }
+	/// \}
+};
+}
+
+#endif
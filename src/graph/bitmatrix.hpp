@@ -0,0 +1,315 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef GRAPH__BITMATRIX__HPP
+#define GRAPH__BITMATRIX__HPP
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include <cassert>
+#include <graph/edge.hpp>
+#include <utils/bits.hpp>
+
+namespace graph
+{
+/// This class represents an unweighted graph, implemented as adjacency
+/// matrix with one bit per edge.
+///
+/// The matrix is stored row by row, each row (all outgoing edges of
+/// a vertex) occupies a whole number of words. Counting and listing
+/// outgoing edges operate on complete words instead of single bits.
+///
+/// Properties for vertices and/or edges are not possible, for weighted
+/// graphs use `adjmatrix`.
+///
+/// Once constructed, the size is constant. It is not possible to
+/// grow or shrink.
+///
+class bitmatrix
+{
+public:
+	using size_type = vertex;
+
+private:
+	using word = utils::word;
+
+	const size_type n; // number of vertices
+	const size_type w; // number of words per row
+	std::vector<word> m; // adjacency matrix
+
+	/// Computes the index of the word containing the specified edge.
+	size_type word_index(edge e) const noexcept { return e.from * w + e.to / utils::word_bits; }
+
+	/// Computes the mask of the specified edge within its word.
+	static word bit_mask(edge e) noexcept { return word{1} << (e.to % utils::word_bits); }
+
+public:
+	/// \{
+	/// Constructor to set the size of the matrix and initialize it
+	/// with no edges.
+	///
+	/// \param[in] n Size of the matrix.
+	bitmatrix(size_type n)
+		: n(n)
+		, w(utils::words_for_bits(n))
+		, m(n * w, 0)
+	{
+		assert(n > 0);
+	}
+
+	bitmatrix(size_type n, std::initializer_list<edge> edges)
+		: bitmatrix(n)
+	{
+		for (auto const & e : edges)
+			add(e);
+	}
+
+	bitmatrix(const bitmatrix &) = default;
+	bitmatrix(bitmatrix &&) = default;
+	/// \}
+
+	/// \{
+	bitmatrix & operator=(const bitmatrix &) = default;
+	bitmatrix & operator=(bitmatrix &&) = default;
+	/// \}
+
+	/// \{
+	/// Adds an edge to the matrix.
+	///
+	/// Complexity: O(1)
+	///
+	/// \param[in] e The edge to add
+	/// \param[in] type Type of edge to add
+	/// \return true on success, false otherwise
+	///
+	/// \note This function performs boundary check.
+	bool add(edge e, edge::type type = edge::type::uni)
+	{
+		if ((e.from >= n) || (e.to >= n))
+			return false;
+		m[word_index(e)] |= bit_mask(e);
+		if (type == edge::type::bi)
+			m[word_index(e.reverse())] |= bit_mask(e.reverse());
+		return true;
+	}
+
+	/// \see add()
+	bool add(vertex from, vertex to, edge::type type = edge::type::uni)
+	{
+		return add({from, to}, type);
+	}
+	/// \}
+
+	/// \{
+	/// Removes an edge from the matrix.
+	///
+	/// Complexity: O(1)
+	///
+	/// \param[in] e Edge to remove
+	/// \param[in] type Type of edge to add
+	/// \return true on success, false otherwise
+	///
+	/// \note This function performs boundary check.
+	bool remove(edge e, edge::type type = edge::type::uni)
+	{
+		if ((e.from >= n) || (e.to >= n))
+			return false;
+		m[word_index(e)] &= ~bit_mask(e);
+		if (type == edge::type::bi)
+			m[word_index(e.reverse())] &= ~bit_mask(e.reverse());
+		return true;
+	}
+
+	/// \see remove()
+	bool remove(vertex from, vertex to, edge::type type = edge::type::uni)
+	{
+		return remove({from, to}, type);
+	}
+	/// \}
+
+	/// \{
+	/// Accessor for edges. This method provides read only access
+	/// to the matrix and is not boundary checked.
+	///
+	/// Complexity: O(1)
+	bool at(edge e) const { return (m[word_index(e)] & bit_mask(e)) != 0; }
+
+	/// Convenience function. See \see at(edge) const
+	bool at(vertex from, vertex to) const { return at({from, to}); }
+
+	/// Accessor for edges, uses index operator.
+	bool operator[](edge e) const { return at(e); }
+	/// \}
+
+	/// \{
+	/// Returns the size of the matrix (number of vertices).
+	size_type size() const noexcept { return n; }
+
+	/// Returns a list of vertices. This function is for convinience only.
+	///
+	/// Complexity: O(n)
+	vertex_list vertices() const
+	{
+		vertex_list v(size());
+		std::iota(v.begin(), v.end(), 0);
+		return v;
+	}
+
+	/// Returns the number of incoming edges to the specified vertex.
+	///
+	/// If the specified vertex is invalid the function returns 0.
+	///
+	/// Complexity: O(n)
+	size_type count_incoming(vertex to) const
+	{
+		if (to >= n)
+			return 0;
+		size_type num = 0;
+		for (vertex from = 0; from < n; ++from)
+			if (at({from, to}))
+				++num;
+		return num;
+	}
+
+	/// Returns a list of nodes from where an edge exists.
+	///
+	/// If the specified vertex is invalid, an empty list will return.
+	///
+	/// Complexity: O(n)
+	vertex_list incoming(vertex to) const
+	{
+		vertex_list v;
+		if (to >= n)
+			return v;
+		for (vertex from = 0; from < n; ++from)
+			if (at({from, to}))
+				v.push_back(from);
+		return v;
+	}
+
+	/// Returns the number of outgoing edges of the specified vertex.
+	///
+	/// If the specified vertex is invalid the function returns 0.
+	///
+	/// Complexity: O(n / 64)
+	size_type count_outgoing(vertex from) const
+	{
+		if (from >= n)
+			return 0;
+		size_type num = 0;
+		for (size_type i = from * w; i < (from + 1) * w; ++i)
+			num += utils::popcount(m[i]);
+		return num;
+	}
+
+	/// Returns a list of nodes to where an edge exists.
+	///
+	/// If the specified vertex is invalid, an empty list will return.
+	///
+	/// Complexity: O(n / 64 + d)
+	vertex_list outgoing(vertex from) const
+	{
+		vertex_list v;
+		for_each_outgoing(from, [&v](vertex to) { v.push_back(to); });
+		return v;
+	}
+
+	/// Calls the specified function for each vertex to where an edge exists,
+	/// in ascending order. Used by the algorithms to enumerate neighbors
+	/// without creating a list.
+	///
+	/// If the specified vertex is invalid, the function is not called.
+	///
+	/// Complexity: O(n / 64 + d)
+	template <class Function> void for_each_outgoing(vertex from, Function && f) const
+	{
+		if (from >= n)
+			return;
+		for (size_type i = 0; i < w; ++i) {
+			const vertex base = i * utils::word_bits;
+			utils::for_each_bit(m[from * w + i], [&f, base](unsigned b) { f(base + b); });
+		}
+	}
+
+	/// Returns the next vertex to where an edge exists, in ascending order,
+	/// or `vertex_invalid` if there are no more. The cursor keeps track of the
+	/// progress, it must be initialized with zero. Used by the algorithms to
+	/// enumerate neighbors step by step, e.g. depth first search.
+	///
+	/// Complexity: O(n / 64 + d) in total for all calls on a vertex
+	vertex next_outgoing(vertex from, std::size_t & cursor) const noexcept
+	{
+		if ((from >= n) || (cursor >= n))
+			return vertex_invalid;
+
+		const word * row = &m[from * w];
+		size_type i = cursor / utils::word_bits;
+		word x = row[i] & (~word{0} << (cursor % utils::word_bits));
+		while (!x) {
+			if (++i >= w) {
+				cursor = n;
+				return vertex_invalid;
+			}
+			x = row[i];
+		}
+		const vertex to = i * utils::word_bits + utils::count_trailing_zeros(x);
+		cursor = to + 1;
+		return to;
+	}
+	/// \}
+
+	/// \{
+	/// Returns the total number of edges within the matrix.
+	///
+	/// Complexity: O(n^2 / 64)
+	size_type count_edges() const noexcept
+	{
+		return std::accumulate(m.begin(), m.end(), size_type{0},
+			[](size_type sum, word x) { return sum + utils::popcount(x); });
+	}
+
+	/// Returns a list of edges defined by the matrix.
+	///
+	/// Complexity: O(n^2 / 64 + m)
+	edge_list edges() const
+	{
+		edge_list vec;
+		for (vertex from = 0; from < n; ++from)
+			for (auto const to : outgoing(from))
+				vec.emplace_back(from, to);
+		return vec;
+	}
+	/// \}
+};
+}
+
+#endif
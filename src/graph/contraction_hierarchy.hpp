@@ -0,0 +1,629 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef GRAPH__CONTRACTION_HIERARCHY__HPP
+#define GRAPH__CONTRACTION_HIERARCHY__HPP
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <tuple>
+#include <vector>
+#include <graph/type_traits.hpp>
+#include <graph/edge.hpp>
+#include <graph/weight.hpp>
+#include <graph/dijkstra_workspace.hpp>
+#include <graph/path.hpp>
+#include <utils/indexed_priority_queue.hpp>
+
+namespace graph
+{
+/// \cond DEV
+namespace detail
+{
+/// Graph of the vertices not contracted yet, used while building a
+/// contraction_hierarchy.
+///
+/// Every edge is stored twice, as outgoing edge of its source and as
+/// incoming edge of its target. Between two vertices there is at most one
+/// edge in each direction, the one with the smallest weight. Edges of
+/// contracted vertices are removed from their neighbors, but kept by the
+/// contracted vertex itself: they become the edges of the hierarchy.
+template <class Value> class contraction_graph
+{
+public:
+	/// Edge to (outgoing) or from (incoming) `target`. Shortcuts replace the
+	/// path over the contracted vertex `middle`, which is `vertex_invalid`
+	/// for edges of the original graph.
+	struct arc {
+		vertex target;
+		Value weight;
+		vertex middle;
+	};
+
+	using arc_list = std::vector<arc>;
+
+	/// Number of vertices a witness search settles at most. A witness not
+	/// found within this limit results in an unnecessary shortcut, which does
+	/// not affect correctness.
+	static constexpr vertex witness_limit = 256;
+
+private:
+	std::vector<arc_list> out;
+	std::vector<arc_list> in;
+	std::vector<vertex> deleted; // number of contracted neighbors
+	std::vector<vertex> level; // upper bound of the depth in the hierarchy
+	dijkstra_workspace<Value> ws;
+
+	static typename arc_list::iterator find(arc_list & arcs, vertex target)
+	{
+		return std::find_if(std::begin(arcs), std::end(arcs),
+			[target](const arc & a) { return a.target == target; });
+	}
+
+	static void erase(arc_list & arcs, vertex target)
+	{
+		auto const i = find(arcs, target);
+		if (i != std::end(arcs)) {
+			*i = arcs.back();
+			arcs.pop_back();
+		}
+	}
+
+	/// Searches paths from `source` not containing `skip`, up to the
+	/// distance `limit`, until all targets of `skip` are settled. The
+	/// distances are left in the workspace.
+	void witness_search(vertex source, vertex skip, Value limit)
+	{
+		ws.reset();
+		ws.set(source, Value{}, vertex_invalid);
+		auto & q = ws.queue();
+		q.push(source, Value{});
+
+		auto const is_target = [this, skip](vertex u) {
+			return std::any_of(std::begin(out[skip]), std::end(out[skip]),
+				[u](const arc & a) { return a.target == u; });
+		};
+		auto targets = out[skip].size();
+
+		for (vertex settled = 0; !q.empty() && (settled < witness_limit); ++settled) {
+			if (q.top_priority() > limit)
+				break;
+			const vertex u = q.top();
+			q.pop();
+
+			if (is_target(u) && (--targets == 0))
+				break;
+
+			const Value du = ws.distance(u);
+			for (auto const & a : out[u]) {
+				if (a.target == skip)
+					continue;
+				const Value alt = du + a.weight;
+				if (alt < ws.distance(a.target)) {
+					ws.set(a.target, alt, u);
+					if (q.contains(a.target)) {
+						q.decrease_key(a.target, alt);
+					} else {
+						q.push(a.target, alt);
+					}
+				}
+			}
+		}
+	}
+
+public:
+	explicit contraction_graph(vertex n)
+		: out(n)
+		, in(n)
+		, deleted(n, 0)
+		, level(n, 0)
+		, ws(n)
+	{
+	}
+
+	vertex size() const noexcept { return out.size(); }
+
+	const arc_list & outgoing(vertex v) const { return out[v]; }
+	const arc_list & incoming(vertex v) const { return in[v]; }
+
+	/// Adds the edge, or lowers the weight of an existing edge.
+	void add(vertex from, vertex to, Value weight, vertex middle)
+	{
+		auto const i = find(out[from], to);
+		if (i == std::end(out[from])) {
+			out[from].push_back({to, weight, middle});
+			in[to].push_back({from, weight, middle});
+		} else if (weight < i->weight) {
+			*i = {to, weight, middle};
+			*find(in[to], from) = {from, weight, middle};
+		}
+	}
+
+	/// Calls `f(from, to, weight)` for every shortcut needed to contract
+	/// the vertex `v`: for every path `u -> v -> w` for which the witness
+	/// search finds no path from `u` to `w` avoiding `v` of at most the
+	/// same length.
+	template <class Function> void for_each_shortcut(vertex v, Function f)
+	{
+		for (auto const & a : in[v]) {
+			const vertex u = a.target;
+
+			Value limit{};
+			bool any = false;
+			for (auto const & b : out[v]) {
+				if (b.target != u) {
+					limit = std::max(limit, a.weight + b.weight);
+					any = true;
+				}
+			}
+			if (!any)
+				continue;
+
+			witness_search(u, v, limit);
+			for (auto const & b : out[v]) {
+				const Value length = a.weight + b.weight;
+				if ((b.target != u) && (ws.distance(b.target) > length))
+					f(u, b.target, length);
+			}
+		}
+	}
+
+	/// Returns the priority of the vertex for contraction, lower values are
+	/// contracted first. The main term is the number of necessary shortcuts
+	/// minus the number of removed edges (edge difference). The number of
+	/// already contracted neighbors and the level spread the contraction
+	/// evenly over the graph, which keeps the hierarchy flat.
+	long priority(vertex v)
+	{
+		long shortcuts = 0;
+		for_each_shortcut(v, [&shortcuts](vertex, vertex, Value) { ++shortcuts; });
+		const long difference = shortcuts - static_cast<long>(in[v].size() + out[v].size());
+		return 2 * difference + static_cast<long>(deleted[v] + level[v]);
+	}
+
+	/// Contracts the vertex: adds the necessary shortcuts and removes the
+	/// vertex from its neighbors.
+	void contract(vertex v)
+	{
+		for_each_shortcut(v, [this, v](vertex from, vertex to, Value weight) {
+			add(from, to, weight, v);
+		});
+		for (auto const & a : out[v]) {
+			erase(in[a.target], v);
+			++deleted[a.target];
+			level[a.target] = std::max(level[a.target], level[v] + 1);
+		}
+		for (auto const & a : in[v]) {
+			erase(out[a.target], v);
+			++deleted[a.target];
+			level[a.target] = std::max(level[a.target], level[v] + 1);
+		}
+	}
+};
+
+template <class Value> constexpr vertex contraction_graph<Value>::witness_limit;
+}
+/// \endcond
+
+/// Preprocessed graph for fast point to point shortest path queries on a
+/// static graph, see shortest_path_contraction_hierarchy().
+///
+/// The vertices are contracted one by one, in the order of their importance:
+/// a contracted vertex is removed from the graph, and shortcut edges between
+/// its neighbors preserve the shortest paths which lead over it. The position
+/// in this order is the rank of a vertex. Every edge, original or shortcut,
+/// leads either upwards (to a higher rank) or downwards. A shortest path
+/// always exists which first leads only upwards and then only downwards,
+/// therefore a query is a bidirectional search which follows upward edges
+/// from the start and, backwards, downward edges from the destination. Both
+/// searches settle only a few vertices, typically a few hundred on road
+/// networks with millions of vertices.
+///
+/// The edges are stored in the compressed sparse row format (see `csr`):
+/// the upward edges at their source, the downward edges at their target.
+///
+/// The hierarchy is immutable, it must be rebuilt if the graph changes.
+///
+/// \tparam Value The type of the edge weights (distances), must not be negative.
+///
+template <class Value> class contraction_hierarchy
+{
+public:
+	using value_type = Value;
+	using size_type = vertex;
+
+private:
+	size_type n; // number of vertices
+	size_type shortcuts = 0;
+	std::vector<size_type> ranks;
+
+	// per vertex: edges to vertices of higher rank, in [up_offsets[v], up_offsets[v + 1])
+	std::vector<size_type> up_offsets;
+	vertex_list up_targets;
+	std::vector<value_type> up_weights;
+	vertex_list up_middles;
+
+	// per vertex: edges from vertices of higher rank, stored at the target
+	std::vector<size_type> down_offsets;
+	vertex_list down_sources;
+	std::vector<value_type> down_weights;
+	vertex_list down_middles;
+
+	/// Contracts all vertices and builds the hierarchy.
+	///
+	/// Complexity: depends heavily on the structure of the graph, the number
+	///   of shortcuts and the cost of witness searches.
+	template <class Weights> void build(const Weights & weights)
+	{
+		using arc_list = typename detail::contraction_graph<value_type>::arc_list;
+
+		detail::contraction_graph<value_type> cg(n);
+		for (vertex u = 0; u < n; ++u) {
+			weights.for_each_outgoing(u, [&cg, u](vertex v, typename Weights::value_type w) {
+				if (u != v)
+					cg.add(u, v, static_cast<value_type>(w), vertex_invalid);
+			});
+		}
+
+		// order by priority, contract the vertex with the lowest priority
+		utils::indexed_priority_queue<long> q(n);
+		for (vertex v = 0; v < n; ++v)
+			q.push(v, cg.priority(v));
+
+		vertex_list neighbors;
+		for (size_type rank = 0; !q.empty();) {
+			const vertex v = q.top();
+
+			// priorities are updated lazily, contract only if still the lowest
+			const long p = cg.priority(v);
+			if (p > q.top_priority()) {
+				q.update(v, p);
+				if (q.top() != v)
+					continue;
+			}
+
+			q.pop();
+			cg.contract(v);
+			ranks[v] = rank++;
+
+			// contraction changes the priorities of the neighbors
+			neighbors.clear();
+			for (auto const & a : cg.outgoing(v))
+				neighbors.push_back(a.target);
+			for (auto const & a : cg.incoming(v))
+				neighbors.push_back(a.target);
+			std::sort(std::begin(neighbors), std::end(neighbors));
+			neighbors.erase(
+				std::unique(std::begin(neighbors), std::end(neighbors)), std::end(neighbors));
+			for (auto const u : neighbors)
+				if (q.contains(u))
+					q.update(u, cg.priority(u));
+		}
+
+		// the remaining edges of a contracted vertex lead to vertices of higher rank
+		auto const store = [this](const arc_list & arcs, std::vector<size_type> & offsets,
+							   vertex_list & targets, std::vector<value_type> & values,
+							   vertex_list & middles) {
+			offsets.push_back(offsets.back() + arcs.size());
+			for (auto const & a : arcs) {
+				targets.push_back(a.target);
+				values.push_back(a.weight);
+				middles.push_back(a.middle);
+				if (a.middle != vertex_invalid)
+					++shortcuts;
+			}
+		};
+		up_offsets.assign(1, 0);
+		down_offsets.assign(1, 0);
+		for (vertex v = 0; v < n; ++v) {
+			store(cg.outgoing(v), up_offsets, up_targets, up_weights, up_middles);
+			store(cg.incoming(v), down_offsets, down_sources, down_weights, down_middles);
+		}
+	}
+
+	/// Returns the vertex contracted to create the shortcut `from -> to`, or
+	/// `vertex_invalid` for an edge of the original graph.
+	vertex middle(vertex from, vertex to) const
+	{
+		if (ranks[from] < ranks[to]) {
+			for (auto i = up_offsets[from]; i < up_offsets[from + 1]; ++i)
+				if (up_targets[i] == to)
+					return up_middles[i];
+		} else {
+			for (auto i = down_offsets[to]; i < down_offsets[to + 1]; ++i)
+				if (down_sources[i] == from)
+					return down_middles[i];
+		}
+		return vertex_invalid;
+	}
+
+public:
+	/// \{
+	/// Builds the hierarchy of the graph, the weights of the edges are the
+	/// values stored in the graph.
+	///
+	/// \tparam Graph The graph type, see shortest_path_dijkstra()
+	/// \param[in] g The graph
+	template <class Graph,
+		typename = typename std::enable_if<detail::has_t_value_type<Graph>::value
+				&& detail::has_f_size<Graph>::value && detail::has_f_at<Graph>::value
+				&& detail::has_f_outgoing<Graph>::value,
+			void>::type>
+	explicit contraction_hierarchy(const Graph & g)
+		: n(g.size())
+		, ranks(n)
+	{
+		build(detail::make_weights(g));
+	}
+
+	/// Builds the hierarchy of the graph, the weights of the edges are
+	/// provided by the property map.
+	///
+	/// \tparam Graph The graph type, see shortest_path_dijkstra()
+	/// \tparam PropertyMap The weights of the edges, see shortest_path_dijkstra()
+	/// \param[in] g The graph
+	/// \param[in] p The property map, containing the weights of the edges
+	template <class Graph, class PropertyMap,
+		typename = typename std::enable_if<detail::has_f_size<Graph>::value
+				&& detail::has_f_outgoing<Graph>::value
+				&& detail::is_edge_property_map<PropertyMap>::value,
+			void>::type>
+	contraction_hierarchy(const Graph & g, const PropertyMap & p)
+		: n(g.size())
+		, ranks(n)
+	{
+		build(detail::make_weights(g, p));
+	}
+
+	contraction_hierarchy(const contraction_hierarchy &) = default;
+	contraction_hierarchy(contraction_hierarchy &&) = default;
+	/// \}
+
+	/// \{
+	contraction_hierarchy & operator=(const contraction_hierarchy &) = default;
+	contraction_hierarchy & operator=(contraction_hierarchy &&) = default;
+	/// \}
+
+	/// \{
+	/// Returns the number of vertices.
+	size_type size() const noexcept { return n; }
+
+	/// Returns the position of the vertex in the contraction order.
+	size_type rank(vertex v) const { return ranks[v]; }
+
+	/// Returns the number of edges (upwards and downwards), including shortcuts.
+	size_type count_edges() const noexcept { return up_targets.size() + down_sources.size(); }
+
+	/// Returns the number of shortcuts.
+	size_type count_shortcuts() const noexcept { return shortcuts; }
+	/// \}
+
+	/// \{
+	/// Calls `f(vertex to, value_type weight)` for all edges from the vertex
+	/// to vertices of higher rank.
+	template <class Function> void for_each_upward(vertex v, Function && f) const
+	{
+		for (auto i = up_offsets[v]; i < up_offsets[v + 1]; ++i)
+			f(up_targets[i], up_weights[i]);
+	}
+
+	/// Calls `f(vertex from, value_type weight)` for all edges from vertices
+	/// of higher rank to the vertex.
+	template <class Function> void for_each_downward(vertex v, Function && f) const
+	{
+		for (auto i = down_offsets[v]; i < down_offsets[v + 1]; ++i)
+			f(down_sources[i], down_weights[i]);
+	}
+	/// \}
+
+	/// Appends the vertices of the edge `from -> to` of the hierarchy to the
+	/// path, with all shortcuts replaced by the original edges. The vertex
+	/// `from` is not appended.
+	///
+	/// Complexity: O(k d) with `k` the number of original edges
+	void unpack(vertex from, vertex to, vertex_list & path) const
+	{
+		const vertex m = middle(from, to);
+		if (m == vertex_invalid) {
+			path.push_back(to);
+			return;
+		}
+		unpack(from, m, path);
+		unpack(m, to, path);
+	}
+};
+
+/// \cond DEV
+namespace detail
+{
+/// Settles the vertex on top of the queue of one direction of the contraction
+/// hierarchy query, like bidirectional_dijkstra_step(), using `for_each_edge`
+/// to enumerate the edges leading upwards in the search direction.
+///
+/// Stall on demand: if an edge against the search direction (enumerated by
+/// `for_each_reverse`) from a reached vertex offers a shorter distance, the
+/// vertex is not on a shortest path of this search and its edges are not
+/// relaxed. This prunes a large part of the search space.
+template <class Value, class EdgeEnumerator, class ReverseEnumerator>
+void contraction_hierarchy_step(dijkstra_workspace<Value> & ws,
+	const dijkstra_workspace<Value> & other, EdgeEnumerator for_each_edge,
+	ReverseEnumerator for_each_reverse, Value & best, vertex & meet)
+{
+	auto & q = ws.queue();
+	const vertex u = q.top();
+	q.pop();
+
+	const Value du = ws.distance(u);
+	if (other.reached(u) && (du + other.distance(u) < best)) {
+		best = du + other.distance(u);
+		meet = u;
+	}
+
+	bool stalled = false;
+	for_each_reverse(u, [&](vertex x, Value w) {
+		if (ws.reached(x) && (ws.distance(x) + w < du))
+			stalled = true;
+	});
+	if (stalled)
+		return;
+
+	for_each_edge(u, [&](vertex v, Value w) {
+		const Value alt = du + w;
+		if (alt < ws.distance(v)) {
+			ws.set(v, alt, u);
+			if (q.contains(v)) {
+				q.decrease_key(v, alt);
+			} else {
+				q.push(v, alt);
+			}
+		}
+	});
+}
+}
+/// \endcond
+
+/// Finds the shortest path from the start to the destination, using the
+/// preprocessed contraction hierarchy.
+///
+/// Runs a forward search from the start on the upward edges and a backward
+/// search from the destination on the downward edges, see
+/// shortest_path_bidirectional_dijkstra(). In contrast to the bidirectional
+/// search on the original graph, each search continues until the smallest
+/// distance in its queue is not smaller than the shortest path found so far,
+/// since the searches do not settle the vertices in order of their distances
+/// in the original graph. Vertices reached on a detour are not expanded
+/// (stall on demand). The path of the hierarchy is finally unpacked to the
+/// vertices of the original graph.
+///
+/// With the specified workspaces and path reused, a query does not allocate
+/// memory.
+///
+/// Complexity: O((n + m) log n) in the worst case, for road networks the
+///   searches settle typically only a few hundred vertices.
+///
+/// \param[in] ch The contraction hierarchy of the graph
+/// \param[in] start The staring node
+/// \param[in] destination The destination node
+/// \param[in,out] forward The workspace of the search from the start
+/// \param[in,out] backward The workspace of the search from the destination
+/// \param[out] path List of vertices from start to destination (inclusive),
+///   empty if the destination is not reachable.
+/// \return true if the destination is reachable, false otherwise
+///
+template <class Value>
+bool shortest_path_contraction_hierarchy(const contraction_hierarchy<Value> & ch,
+	vertex start, vertex destination, dijkstra_workspace<Value> & forward,
+	dijkstra_workspace<Value> & backward, vertex_list & path)
+{
+	constexpr Value infinity = dijkstra_workspace<Value>::infinity;
+
+	path.clear();
+	if ((start >= ch.size()) || (destination >= ch.size()) || (forward.size() < ch.size())
+		|| (backward.size() < ch.size()))
+		return false;
+
+	forward.reset();
+	forward.set(start, Value{}, vertex_invalid);
+	forward.queue().push(start, Value{});
+	backward.reset();
+	backward.set(destination, Value{}, vertex_invalid);
+	backward.queue().push(destination, Value{});
+
+	Value best = (start == destination) ? Value{} : infinity;
+	vertex meet = (start == destination) ? start : vertex_invalid;
+
+	auto const upward = [&ch](vertex u, auto && f) { ch.for_each_upward(u, f); };
+	auto const downward = [&ch](vertex u, auto && f) { ch.for_each_downward(u, f); };
+
+	for (;;) {
+		auto const & qf = forward.queue();
+		auto const & qb = backward.queue();
+		const bool done_forward = qf.empty() || (qf.top_priority() >= best);
+		const bool done_backward = qb.empty() || (qb.top_priority() >= best);
+		if (done_forward && done_backward)
+			break;
+
+		if (!done_forward && (done_backward || (qf.top_priority() <= qb.top_priority()))) {
+			detail::contraction_hierarchy_step(forward, backward, upward, downward, best, meet);
+		} else {
+			detail::contraction_hierarchy_step(backward, forward, downward, upward, best, meet);
+		}
+	}
+
+	if (meet == vertex_invalid)
+		return false;
+
+	// path within the hierarchy, from the start up to the meeting vertex
+	// and down to the destination
+	for (vertex u = meet; u != vertex_invalid; u = forward.predecessor(u))
+		path.push_back(u);
+	std::reverse(std::begin(path), std::end(path));
+	for (vertex u = backward.predecessor(meet); u != vertex_invalid;
+		 u = backward.predecessor(u))
+		path.push_back(u);
+
+	// unpack shortcuts behind the path of the hierarchy, then drop the latter
+	const auto k = path.size();
+	path.push_back(path.front());
+	for (std::size_t i = 1; i < k; ++i)
+		ch.unpack(path[i - 1], path[i], path);
+	path.erase(std::begin(path), std::begin(path) + k);
+	return true;
+}
+
+/// Finds the shortest path from the start to the destination, using the
+/// preprocessed contraction hierarchy, with temporary workspaces.
+///
+/// \see shortest_path_contraction_hierarchy(const contraction_hierarchy &, vertex,
+///   vertex, dijkstra_workspace &, dijkstra_workspace &, vertex_list &)
+///
+/// \param[in] ch The contraction hierarchy of the graph
+/// \param[in] start The staring node
+/// \param[in] destination The destination node
+/// \return A tuple with the following information:
+///   - list of vertices from start to destination (inclusive)
+///   - status about success, if false: destination not reachable
+///
+template <class Value>
+std::tuple<vertex_list, bool> shortest_path_contraction_hierarchy(
+	const contraction_hierarchy<Value> & ch, vertex start, vertex destination)
+{
+	dijkstra_workspace<Value> forward(ch.size());
+	dijkstra_workspace<Value> backward(ch.size());
+	vertex_list path;
+	const bool found
+		= shortest_path_contraction_hierarchy(ch, start, destination, forward, backward, path);
+	return std::make_tuple(path, found);
+}
+}
+
+#endif
@@ -0,0 +1,267 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef GRAPH__CSR__HPP
+#define GRAPH__CSR__HPP
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include <cassert>
+#include <graph/edge.hpp>
+
+namespace graph
+{
+/// Represents a graph in the compressed sparse row format.
+///
+/// All outgoing edges of all vertices are stored consecutively in one
+/// single container (`targets`), grouped by their starting vertex. The
+/// container `offsets` holds for each vertex the position of its first
+/// outgoing edge, the outgoing edges of vertex `v` are therefore found in
+/// the range `[offsets[v], offsets[v + 1])`. Within this range the
+/// vertices are sorted in ascending order.
+///
+/// Compared to `adjlist` there is no allocation per vertex, all neighbors
+/// are stored next to each other in memory. The price to pay: the graph
+/// is immutable, all edges must be known at construction.
+///
+/// Properties for vertices and/or edges are not possible.
+///
+/// Hits to complexity of member functions is in the form: `O(n + m)`
+/// with `n` as number of vertices and `m` as number of edges, `d` is
+/// the number of outgoing edges of a vertex.
+///
+class csr
+{
+public:
+	using size_type = vertex;
+
+private:
+	const size_type n; // number of vertices
+
+	// position of the first outgoing edge for each vertex, n + 1 entries
+	std::vector<size_type> offsets;
+
+	// outgoing edges of all vertices, grouped by vertex
+	vertex_list targets;
+
+	/// Builds the compressed representation of the specified edges.
+	/// Edges with invalid vertices are ignored, duplicates are removed.
+	///
+	/// Complexity: O(n + m log m)
+	template <class Iterator> void build(Iterator first, Iterator last)
+	{
+		// count edges per vertex and compute offsets
+		offsets.assign(n + 1, 0);
+		for (auto i = first; i != last; ++i)
+			if ((i->from < n) && (i->to < n))
+				++offsets[i->from + 1];
+		std::partial_sum(std::begin(offsets), std::end(offsets), std::begin(offsets));
+
+		// place edges
+		targets.resize(offsets[n]);
+		std::vector<size_type> pos(std::begin(offsets), std::end(offsets) - 1);
+		for (auto i = first; i != last; ++i)
+			if ((i->from < n) && (i->to < n))
+				targets[pos[i->from]++] = i->to;
+
+		// sort neighbors, remove duplicates and compact
+		size_type w = 0;
+		for (vertex v = 0; v < n; ++v) {
+			auto const b = std::begin(targets) + offsets[v];
+			auto const e = std::begin(targets) + offsets[v + 1];
+			std::sort(b, e);
+			offsets[v] = w;
+			w = std::move(b, std::unique(b, e), std::begin(targets) + w) - std::begin(targets);
+		}
+		offsets[n] = w;
+		targets.resize(w);
+		targets.shrink_to_fit();
+	}
+
+public:
+	/// \{
+	/// Constructor to set the size of the graph and initialize it
+	/// with no edges.
+	///
+	/// \param[in] n Size of the graph.
+	csr(size_type n)
+		: n(n)
+		, offsets(n + 1, 0)
+	{
+		assert(n > 0);
+	}
+
+	/// Constructor which takes the number of vertices and an initializer list
+	/// of edges to initialize the graph.
+	///
+	/// \param[in] n Number of vertices, i.e. the size of the graph.
+	/// \param[in] edges Edges to initialize the graph with.
+	csr(size_type n, std::initializer_list<edge> edges)
+		: n(n)
+	{
+		assert(n > 0);
+		build(std::begin(edges), std::end(edges));
+	}
+
+	/// Constructor which takes the number of vertices and a list
+	/// of edges to initialize the graph.
+	///
+	/// Complexity: O(n + m log m)
+	///
+	/// \param[in] n Number of vertices, i.e. the size of the graph.
+	/// \param[in] edges Edges to initialize the graph with.
+	csr(size_type n, const edge_list & edges)
+		: n(n)
+	{
+		assert(n > 0);
+		build(std::begin(edges), std::end(edges));
+	}
+
+	csr(const csr &) = default;
+	csr(csr &&) = default;
+	/// \}
+
+	/// \{
+	csr & operator=(const csr &) = default;
+	csr & operator=(csr &&) = default;
+	/// \}
+
+	/// \{
+	/// Accessor for edges. This method provides read only access
+	/// to the graph and is not boundary checked.
+	///
+	/// Complexity: O(log d)
+	bool at(edge e) const
+	{
+		auto const b = std::begin(targets) + offsets[e.from];
+		auto const l = std::begin(targets) + offsets[e.from + 1];
+		return std::binary_search(b, l, e.to);
+	}
+
+	/// Convenience function. See \see at(edge) const
+	bool at(vertex from, vertex to) const { return at({from, to}); }
+
+	/// Accessor for edges, uses index operator.
+	bool operator[](edge e) const { return at(e); }
+	/// \}
+
+	/// \{
+	/// Returns the size of the graph (number of vertices).
+	size_type size() const noexcept { return n; }
+
+	/// Returns a list of vertices. This function is for convinience only.
+	///
+	/// Complexity: O(n)
+	vertex_list vertices() const
+	{
+		vertex_list v(size());
+		std::iota(v.begin(), v.end(), 0);
+		return v;
+	}
+
+	/// Returns the number of incoming edges to the specified vertex.
+	///
+	/// If the specified vertex is invalid the function returns 0.
+	///
+	/// Complexity: O(m)
+	size_type count_incoming(vertex to) const
+	{
+		if (to >= n)
+			return 0;
+		return std::count(std::begin(targets), std::end(targets), to);
+	}
+
+	/// Returns a list of nodes from where an edge exists.
+	///
+	/// If the specified vertex is invalid, an empty list will return.
+	///
+	/// Complexity: O(n log d)
+	vertex_list incoming(vertex to) const
+	{
+		vertex_list v;
+		if (to >= n)
+			return v;
+		for (vertex from = 0; from < n; ++from)
+			if (at({from, to}))
+				v.push_back(from);
+		return v;
+	}
+
+	/// Returns the number of outgoing edges of the specified vertex.
+	///
+	/// If the specified vertex is invalid the function returns 0.
+	///
+	/// Complexity: O(1)
+	size_type count_outgoing(vertex from) const
+	{
+		if (from >= n)
+			return 0;
+		return offsets[from + 1] - offsets[from];
+	}
+
+	/// Returns a list of nodes to where an edge exists. The returned
+	/// range refers to the data of the graph, no copy is made.
+	///
+	/// If the specified vertex is invalid, an empty range will return.
+	///
+	/// Complexity: O(1)
+	vertex_range outgoing(vertex from) const
+	{
+		if (from >= n)
+			return {};
+		return {targets.data() + offsets[from], targets.data() + offsets[from + 1]};
+	}
+	/// \}
+
+	/// \{
+	/// Returns the total number of edges within the graph.
+	///
+	/// Complexity: O(1)
+	size_type count_edges() const noexcept { return targets.size(); }
+
+	/// Returns a list of edges defined by the graph.
+	///
+	/// Complexity: O(n + m)
+	edge_list edges() const
+	{
+		edge_list vec;
+		vec.reserve(targets.size());
+		for (vertex from = 0; from < n; ++from)
+			for (auto i = offsets[from]; i < offsets[from + 1]; ++i)
+				vec.emplace_back(from, targets[i]);
+		return vec;
+	}
+	/// \}
+};
+}
+
+#endif
@@ -0,0 +1,273 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef GRAPH__DELTA_STEPPING__HPP
+#define GRAPH__DELTA_STEPPING__HPP
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include <graph/type_traits.hpp>
+#include <graph/edge.hpp>
+#include <graph/weight.hpp>
+#include <graph/path.hpp>
+#include <utils/thread_pool.hpp>
+
+namespace graph
+{
+/// \cond DEV
+namespace detail
+{
+/// Request to relax the distance of `target` via `predecessor`.
+template <class Value> struct delta_stepping_request {
+	vertex target;
+	Value distance;
+	vertex predecessor;
+};
+
+/// State of one thread of the delta stepping. Each thread owns a part of the
+/// vertices, only the owner changes the distance, predecessor and bucket of
+/// a vertex.
+template <class Value> struct delta_stepping_worker {
+	std::vector<vertex_list> buckets; // owned vertices, by bucket
+	vertex_list current; // content of the bucket being processed
+	vertex_list settled; // vertices removed from the current bucket
+	std::vector<std::vector<delta_stepping_request<Value>>> requests; // by owner
+};
+
+/// Detail implementation of the delta stepping.
+///
+/// The algorithm runs in rounds, each executed by all threads of the pool:
+/// in a generating round each thread reads its vertices and emits requests
+/// for the owners of the target vertices, in the following applying round
+/// each thread relaxes the requests for its vertices. Therefore no data
+/// is written by more than one thread, and no atomic operations are needed.
+template <class Graph, class Weights>
+shortest_path_tree<typename Weights::value_type> shortest_paths_delta_stepping(
+	const Graph & g, const Weights & weights, vertex start,
+	typename Weights::value_type delta, utils::thread_pool & pool)
+{
+	using Value = typename Weights::value_type;
+	using request = delta_stepping_request<Value>;
+	using worker = delta_stepping_worker<Value>;
+	constexpr auto npos = std::numeric_limits<std::size_t>::max();
+
+	shortest_path_tree<Value> tree;
+	if ((start >= g.size()) || !(delta > Value{}))
+		return tree;
+
+	const vertex n = g.size();
+	const std::size_t threads = pool.size();
+
+	tree.start = start;
+	tree.distance.assign(n, shortest_path_tree<Value>::infinity);
+	tree.predecessor.assign(n, vertex_invalid);
+	auto & dist = tree.distance;
+	auto & pred = tree.predecessor;
+
+	// bucket in which a vertex is queued, `npos` if not queued
+	std::vector<std::size_t> entry(n, npos);
+
+	std::vector<worker> workers(threads);
+	for (auto & w : workers)
+		w.requests.resize(threads);
+
+	auto const owner = [threads](vertex v) { return v % threads; };
+	auto const bucket_of = [delta](Value d) { return static_cast<std::size_t>(d / delta); };
+
+	auto const relax = [&](worker & w, const request & r) {
+		if (r.distance < dist[r.target]) {
+			dist[r.target] = r.distance;
+			pred[r.target] = r.predecessor;
+			const auto b = bucket_of(r.distance);
+			if (entry[r.target] != b) {
+				if (b >= w.buckets.size())
+					w.buckets.resize(b + 1);
+				w.buckets[b].push_back(r.target);
+				entry[r.target] = b;
+			}
+		}
+	};
+
+	// requests for edges accepted by `filter`, only if they improve the current distance
+	auto const emit = [&](worker & w, vertex u, auto filter) {
+		const Value du = dist[u];
+		weights.for_each_outgoing(u, [&](vertex v, Value c) {
+			if (filter(c) && (du + c < dist[v]))
+				w.requests[owner(v)].push_back({v, du + c, u});
+		});
+	};
+
+	auto const apply = [&](std::size_t i) {
+		for (auto & producer : workers) {
+			for (auto const & r : producer.requests[i])
+				relax(workers[i], r);
+			producer.requests[i].clear();
+		}
+	};
+
+	std::size_t b = 0; // current bucket
+
+	// light edges of the vertices in the current bucket
+	auto const light = [&](std::size_t i) {
+		auto & w = workers[i];
+		if (b >= w.buckets.size())
+			return;
+		w.current.clear();
+		std::swap(w.current, w.buckets[b]);
+		for (auto const u : w.current) {
+			if (entry[u] != b)
+				continue; // moved to a lower bucket
+			entry[u] = npos;
+			w.settled.push_back(u);
+			emit(w, u, [delta](Value c) { return c <= delta; });
+		}
+	};
+
+	// heavy edges of all vertices removed from the current bucket
+	auto const heavy = [&](std::size_t i) {
+		auto & w = workers[i];
+		std::sort(std::begin(w.settled), std::end(w.settled));
+		w.settled.erase(
+			std::unique(std::begin(w.settled), std::end(w.settled)), std::end(w.settled));
+		for (auto const u : w.settled)
+			emit(w, u, [delta](Value c) { return c > delta; });
+		w.settled.clear();
+	};
+
+	// returns true if the bucket of the worker contains vertices still queued in it
+	auto const queued = [&](worker & w, std::size_t k) {
+		if (k >= w.buckets.size())
+			return false;
+		auto & list = w.buckets[k];
+		if (std::none_of(std::begin(list), std::end(list),
+				[&entry, k](vertex v) { return entry[v] == k; }))
+			list.clear();
+		return !list.empty();
+	};
+
+	relax(workers[owner(start)], {start, Value{}, vertex_invalid});
+
+	for (;;) {
+		// find the lowest non empty bucket
+		std::size_t next = npos;
+		for (auto & w : workers) {
+			for (auto k = b; (k < w.buckets.size()) && (k < next); ++k) {
+				if (queued(w, k)) {
+					next = k;
+					break;
+				}
+			}
+		}
+		if (next == npos)
+			break;
+		b = next;
+
+		// light edges may insert vertices into the current bucket again
+		do {
+			pool.run(light);
+			pool.run(apply);
+		} while (std::any_of(std::begin(workers), std::end(workers),
+			[&](worker & w) { return queued(w, b); }));
+
+		// heavy edges lead to higher buckets
+		pool.run(heavy);
+		pool.run(apply);
+	}
+
+	return tree;
+}
+}
+/// \endcond
+
+/// Computes the shortest paths from the start to all vertices of the graph,
+/// like shortest_paths_dijkstra(), in parallel using the delta stepping
+/// algorithm (Meyer, Sanders).
+///
+/// The vertices are kept in buckets of distance ranges of width `delta`.
+/// All vertices of the lowest non empty bucket are processed in parallel:
+/// first the light edges (weight up to `delta`), repeatedly until the bucket
+/// stays empty, then once the heavy edges. A small delta approaches
+/// Dijkstra (little wasted work, little parallelism), a large delta
+/// approaches Bellman-Ford (much parallelism, vertices are relaxed
+/// repeatedly). For random edge weights, the maximum weight divided by the
+/// average degree is a good start.
+///
+/// The vertices are distributed to the threads of the pool. The threads
+/// synchronize twice per phase, graphs with many small phases (large
+/// diameter relative to delta) do not profit much from many threads.
+///
+/// Complexity: O(n + m + L / delta) for random edge weights and a suitable
+///   delta, with `L` the largest distance
+///
+/// \tparam Graph The graph type to visit, see shortest_path_dijkstra()
+///
+/// \param[in] g The graph, must not be modified during the call
+/// \param[in] start The staring node
+/// \param[in] delta Width of the buckets, must be greater than zero
+/// \param[in] pool The threads to run the algorithm
+/// \return The distances and predecessors of all vertices. If the start
+///   vertex or delta is invalid, the containers of the result are empty.
+///
+template <class Graph,
+	typename = typename std::enable_if<detail::has_t_value_type<Graph>::value
+			&& detail::has_t_size_type<Graph>::value && detail::has_f_size<Graph>::value
+			&& detail::has_f_at<Graph>::value && detail::has_f_vertices<Graph>::value
+			&& detail::has_f_outgoing<Graph>::value,
+		void>::type>
+shortest_path_tree<typename Graph::value_type> shortest_paths_delta_stepping(const Graph & g,
+	vertex start, typename Graph::value_type delta, utils::thread_pool & pool)
+{
+	return detail::shortest_paths_delta_stepping(
+		g, detail::make_weights(g), start, delta, pool);
+}
+
+/// Computes the shortest paths from the start to all vertices of the graph
+/// in parallel, with the distances provided by a property map.
+///
+/// \see shortest_paths_delta_stepping(const Graph &, vertex, value_type, thread_pool &)
+///
+template <class Graph, class PropertyMap,
+	typename = typename std::enable_if<detail::has_t_size_type<Graph>::value
+			&& detail::has_f_size<Graph>::value && detail::has_f_vertices<Graph>::value
+			&& detail::has_f_outgoing<Graph>::value
+			&& detail::is_edge_property_map<PropertyMap>::value,
+		void>::type>
+shortest_path_tree<typename PropertyMap::mapped_type> shortest_paths_delta_stepping(
+	const Graph & g, const PropertyMap & p, vertex start,
+	typename PropertyMap::mapped_type delta, utils::thread_pool & pool)
+{
+	return detail::shortest_paths_delta_stepping(
+		g, detail::make_weights(g, p), start, delta, pool);
+}
+}
+
+#endif
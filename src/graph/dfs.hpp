@@ -28,35 +28,100 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+
 #ifndef GRAPH__DFS__HPP
 #define GRAPH__DFS__HPP
 
-#include <graph/type_traits.hpp>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <graph/neighbors.hpp>
 #include <graph/edge.hpp>
+#include <graph/visit.hpp>
+#include <graph/visited_set.hpp>
 
 namespace graph
 {
+/// Entry of the stack used by depth first search, represents a vertex
+/// whose outgoing vertices are being searched.
+struct dfs_frame {
+	vertex v; ///< The vertex.
+	std::size_t cursor; ///< Progress of the enumeration of outgoing vertices.
+};
+
+/// Stack for depth first search. May be provided by the caller to avoid
+/// allocations for repeated searches.
+using dfs_stack = std::vector<dfs_frame>;
+
 /// \cond DEV
 namespace detail
 {
-template <class Graph, class Visitor>
-static void recursive_dfs(
-	const Graph & g, vertex id, Visitor & visitor, visited_vertex_list & visited)
+/// Visitor which does nothing.
+struct no_visitor {
+	template <class... Args> void operator()(const Args &...) const {}
+};
+
+/// Depth first search, using an explicit stack instead of recursion.
+///
+/// Vertices are visited in the same order as a recursive implementation would.
+/// The visitors may return a `visit_result`, see depth_first_search().
+template <class Graph, class PreVisitor, class PostVisitor, class BackEdgeVisitor>
+void iterative_dfs(const Graph & g, vertex start, dfs_stack & stack,
+	visited_set & visited, visited_set & finished, PreVisitor & pre,
+	PostVisitor & post, BackEdgeVisitor & back_edge)
 {
 	// guard
-	if (id >= g.size())
+	if (start >= g.size())
 		return;
-	if (visited[id])
+	if (visited.test(start))
 		return;
 
-	// visit
-	visited[id] = true;
-	visitor(g, id);
+	stack.clear();
+
+	// outgoing vertices of the vertices on the stack, only for graphs not resumable
+	vertex_list buffer;
+
+	// marks the vertex as found, returns false if the search has to stop
+	auto const discover = [&](vertex v) {
+		visited.set(v);
+		const auto result = detail::visit(pre, g, v);
+		if (result == visit_result::stop)
+			return false;
+		if (result == visit_result::skip) {
+			finished.set(v);
+			return detail::visit(post, g, v) != visit_result::stop;
+		}
+		stack.push_back({v, begin_outgoing(g, v, buffer)});
+		return true;
+	};
+
+	if (!discover(start))
+		return;
 
-	// search deeper
-	for (vertex i = 0; i < g.size(); ++i)
-		if ((i != id) && g.at({id, i}))
-			recursive_dfs(g, i, visitor, visited);
+	while (!stack.empty()) {
+		const vertex u = stack.back().v;
+		const vertex v = next_outgoing(g, u, stack.back().cursor, buffer);
+
+		// all outgoing vertices done
+		if (v == vertex_invalid) {
+			finished.set(u);
+			stack.pop_back();
+			if (detail::visit(post, g, u) == visit_result::stop)
+				break;
+			continue;
+		}
+
+		if (!visited.test(v)) {
+			// search deeper
+			if (!discover(v))
+				break;
+		} else if (!finished.test(v)) {
+			// vertex is still on the stack: cycle
+			if (detail::visit(back_edge, g, edge{u, v}) == visit_result::stop)
+				break;
+		}
+	}
+	stack.clear();
 }
 }
 /// \endcond
@@ -64,14 +129,34 @@ static void recursive_dfs(
 /// This algorithm searches the graph and calls the visitor for each
 /// vertex. The strategy is 'depth first'.
 ///
+/// The search does not use recursion, it is therefore safe for deep graphs.
+///
+/// Complexity: O(n + m) for graphs with cheap access to outgoing vertices
+///   (`outgoing(vertex)` returning a reference or view, or `for_each_outgoing`),
+///   O(n^2 / 64 + m) for `bitmatrix`, O(n^2) for matrix like graphs.
+///
+/// Graphs which cannot resume the enumeration of outgoing vertices (providing
+/// only `for_each_outgoing` or `outgoing(vertex)` creating a new list) are
+/// enumerated once per vertex into a buffer, which needs O(m) additional memory
+/// in the worst case.
+///
 /// \tparam Graph The graph type.
 ///   Must provide the following features:
+///   - type 'size_type'
 ///   - function `size_type size() const` which returns the number of nodes in the graph
-///   - function `integral_type at(edge) const` which returns the status of the specified edge.
-///     integral types can implictly converted to `bool`, which is in fact a hard
-///     requirement.
+///   - at least one of the following:
+///     - function `vertex next_outgoing(vertex, std::size_t & cursor) const` which
+///       returns the outgoing vertices one at a time (e.g. `bitmatrix`)
+///     - function `void for_each_outgoing(vertex, Function) const`
+///     - function `outgoing(vertex) const` which returns the outgoing vertices
+///     - function `integral_type at(edge) const` which returns the status of the specified
+///       edge. integral types can implictly converted to `bool`, which is in fact a hard
+///       requirement.
 /// \tparam Visitor The visitor type. Must provide the ability to get called
 ///   with a signature like `(Graph, vertex)`, e.g. `void visitor(const Graph &, vertex v)`.
+///   The visitor may return a `visit_result` to control the search: `skip` does
+///   not search deeper from the visited vertex (its outgoing vertices may still be
+///   found via other vertices), `stop` ends the search, e.g. when a target is found.
 ///
 /// \param[in] g The graph to visit.
 /// \param[in] v The starting vertex.
@@ -79,15 +164,91 @@ static void recursive_dfs(
 /// \return The visitor functor
 ///
 template <class Graph, class Visitor,
-	typename = typename std::enable_if<detail::has_t_size_type<Graph>::value
-			&& detail::has_f_size<Graph>::value && detail::has_f_integral_type_at<Graph>::value,
-		void>::type>
+	typename = typename std::enable_if<detail::is_traversable<Graph>::value, void>::type>
 Visitor depth_first_search(const Graph & g, vertex v, Visitor visitor)
 {
-	visited_vertex_list visited(g.size(), false);
-	detail::recursive_dfs(g, v, visitor, visited);
+	dfs_stack stack;
+	visited_set visited(g.size());
+	visited_set finished(g.size());
+	detail::no_visitor none;
+	detail::iterative_dfs(g, v, stack, visited, finished, visitor, none, none);
 	return visitor;
 }
+
+/// Depth first search with callbacks for all events of the search. The
+/// strategy and order of visited vertices is the same as depth_first_search().
+///
+/// The stack is provided by the caller, which makes it possible to reuse
+/// it (and its allocated memory) for repeated searches. The sets of visited
+/// and finished vertices are still allocated on every call, O(n) bits; for
+/// repeated searches without allocations use the overload which takes them
+/// from the caller as well.
+///
+/// \tparam Graph The graph type, see depth_first_search()
+/// \tparam PreVisitor Called with `(const Graph &, vertex)` when a vertex is
+///   found (pre-order), before its outgoing vertices are searched.
+///   May return a `visit_result`, see depth_first_search(). For `skip` the
+///   vertex is finished (post-order) immediately.
+/// \tparam PostVisitor Called with `(const Graph &, vertex)` when all outgoing
+///   vertices of a vertex are searched (post-order). May return
+///   `visit_result::stop` to end the search.
+/// \tparam BackEdgeVisitor Called with `(const Graph &, edge)` for each edge which
+///   leads back to a vertex on the stack, i.e. which closes a cycle. May return
+///   `visit_result::stop` to end the search, e.g. at the first cycle found.
+///
+/// \param[in] g The graph to visit.
+/// \param[in] v The starting vertex.
+/// \param[in,out] stack The stack used for the search. Its contents are overwritten,
+///   it is empty after the search.
+/// \param[in] pre Pre-order visitor
+/// \param[in] post Post-order visitor
+/// \param[in] back_edge Back edge visitor
+///
+template <class Graph, class PreVisitor, class PostVisitor = detail::no_visitor,
+	class BackEdgeVisitor = detail::no_visitor,
+	typename = typename std::enable_if<detail::is_traversable<Graph>::value
+			&& !std::is_same<typename std::decay<PreVisitor>::type, visited_set>::value,
+		void>::type>
+void depth_first_search(const Graph & g, vertex v, dfs_stack & stack, PreVisitor && pre,
+	PostVisitor && post = PostVisitor{}, BackEdgeVisitor && back_edge = BackEdgeVisitor{})
+{
+	visited_set visited(g.size());
+	visited_set finished(g.size());
+	detail::iterative_dfs(g, v, stack, visited, finished, pre, post, back_edge);
+}
+
+/// Depth first search with callbacks for all events of the search, with
+/// all state provided by the caller, which makes it possible to reuse it for
+/// repeated searches without allocations: once the stack and the sets have
+/// grown to the size of the graph, no memory is allocated anymore. Graphs
+/// which cannot resume the enumeration of outgoing vertices (see
+/// depth_first_search()) still need a buffer per call.
+///
+/// \see depth_first_search(const Graph &, vertex, dfs_stack &, PreVisitor &&,
+///   PostVisitor &&, BackEdgeVisitor &&)
+///
+/// \param[in] g The graph to visit.
+/// \param[in] v The starting vertex.
+/// \param[in,out] stack The stack used for the search. Its contents are overwritten,
+///   it is empty after the search.
+/// \param[out] visited The vertices found by the search. Its contents are overwritten.
+/// \param[out] finished The vertices whose outgoing vertices are all searched.
+///   Its contents are overwritten.
+/// \param[in] pre Pre-order visitor
+/// \param[in] post Post-order visitor
+/// \param[in] back_edge Back edge visitor
+///
+template <class Graph, class PreVisitor, class PostVisitor = detail::no_visitor,
+	class BackEdgeVisitor = detail::no_visitor,
+	typename = typename std::enable_if<detail::is_traversable<Graph>::value, void>::type>
+void depth_first_search(const Graph & g, vertex v, dfs_stack & stack, visited_set & visited,
+	visited_set & finished, PreVisitor && pre, PostVisitor && post = PostVisitor{},
+	BackEdgeVisitor && back_edge = BackEdgeVisitor{})
+{
+	visited.reset(g.size());
+	finished.reset(g.size());
+	detail::iterative_dfs(g, v, stack, visited, finished, pre, post, back_edge);
+}
 }
 
 #endif
@@ -0,0 +1,139 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef GRAPH__DIJKSTRA_WORKSPACE__HPP
+#define GRAPH__DIJKSTRA_WORKSPACE__HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <graph/edge.hpp>
+#include <utils/indexed_priority_queue.hpp>
+
+namespace graph
+{
+/// Memory for shortest path searches, reusable for many queries on graphs
+/// of the same size.
+///
+/// All containers are allocated once at construction. Instead of resetting
+/// the distances and predecessors of all vertices for every query, each
+/// entry carries the number of the query (epoch) which wrote it. Entries of
+/// previous queries count as not reached, therefore starting a new query
+/// is `O(1)` and only vertices reached by the query are written.
+///
+/// \tparam Value The type of the distances.
+///
+template <class Value> class dijkstra_workspace
+{
+public:
+	using value_type = Value;
+	using size_type = vertex;
+	using queue_type = utils::indexed_priority_queue<value_type>;
+
+	/// Distance of vertices which were not reached.
+	static constexpr value_type infinity = std::numeric_limits<value_type>::max();
+
+private:
+	using epoch_type = std::uint32_t;
+
+	std::vector<value_type> dist;
+	vertex_list pred;
+	std::vector<epoch_type> stamp; // epoch of the last write of an entry
+	epoch_type epoch = 1;
+	queue_type q;
+
+public:
+	/// \{
+	/// Creates a workspace for graphs with the specified number of vertices.
+	///
+	/// Complexity: O(n)
+	explicit dijkstra_workspace(size_type n)
+		: dist(n)
+		, pred(n)
+		, stamp(n, 0)
+		, q(n)
+	{
+	}
+
+	dijkstra_workspace(const dijkstra_workspace &) = default;
+	dijkstra_workspace(dijkstra_workspace &&) = default;
+	/// \}
+
+	/// \{
+	dijkstra_workspace & operator=(const dijkstra_workspace &) = default;
+	dijkstra_workspace & operator=(dijkstra_workspace &&) = default;
+	/// \}
+
+	/// Returns the number of vertices the workspace was created for.
+	size_type size() const noexcept { return stamp.size(); }
+
+	/// Starts a new query, all vertices become unreached.
+	///
+	/// Complexity: O(k) with `k` vertices left in the queue by the previous
+	///   query, except for every 2^32-1 calls which is O(n)
+	void reset()
+	{
+		q.clear();
+		if (++epoch == 0) {
+			std::fill(std::begin(stamp), std::end(stamp), 0);
+			epoch = 1;
+		}
+	}
+
+	/// \{
+	/// Returns true if the vertex was reached by the current query.
+	bool reached(vertex v) const { return stamp[v] == epoch; }
+
+	/// Returns the distance of the vertex, or `infinity` if it was not reached.
+	value_type distance(vertex v) const { return reached(v) ? dist[v] : infinity; }
+
+	/// Returns the predecessor of the vertex, or `vertex_invalid` if it was
+	/// not reached or is the start of the query.
+	vertex predecessor(vertex v) const { return reached(v) ? pred[v] : vertex_invalid; }
+
+	/// Sets distance and predecessor of the vertex, which becomes reached.
+	void set(vertex v, value_type distance, vertex predecessor)
+	{
+		stamp[v] = epoch;
+		dist[v] = distance;
+		pred[v] = predecessor;
+	}
+	/// \}
+
+	/// Returns the priority queue of the current query.
+	queue_type & queue() noexcept { return q; }
+};
+
+template <class Value> constexpr Value dijkstra_workspace<Value>::infinity;
+}
+
+#endif
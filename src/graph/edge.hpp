@@ -32,6 +32,7 @@
 #define GRAPH__EDGE__HPP
 
 #include <vector>
+#include <cstdint>
 #include <functional>
 #include <graph/vertex.hpp>
 
@@ -100,12 +101,32 @@ using edge_list = std::vector<edge>;
 
 /// Default hash function for edges.
 ///
-/// Please note: it does not claim to be a good hash.
+/// Both vertices are packed into one 64 bit word (the starting vertex
+/// rotated by 32 bits, combined with the ending vertex), which is then mixed
+/// by a multiply-xorshift finalizer (splitmix64). For graphs with less
+/// than 2^32 vertices, distinct edges always have distinct hash values,
+/// and all bits of the hash value depend on both vertices. This makes it
+/// suitable for power of two sized tables as well.
 struct edge_hash {
-	std::size_t operator()(const graph::edge & e) const
+	/// Mixes all bits of the specified value, the function is a bijection.
+	static constexpr std::uint64_t mix(std::uint64_t x) noexcept
 	{
-		std::hash<graph::vertex> h;
-		return 0xabcdef123 + h(e.from) + (h(e.from) << 4) + (h(e.to) << 3);
+		return mix_step(mix_step(mix_step(x, 30) * 0xbf58476d1ce4e5b9ull, 27)
+				* 0x94d049bb133111ebull,
+			31);
+	}
+
+	std::size_t operator()(const graph::edge & e) const noexcept
+	{
+		const std::uint64_t from = e.from;
+		const std::uint64_t to = e.to;
+		return static_cast<std::size_t>(mix(((from << 32) | (from >> 32)) ^ to));
+	}
+
+private:
+	static constexpr std::uint64_t mix_step(std::uint64_t x, unsigned shift) noexcept
+	{
+		return x ^ (x >> shift);
 	}
 };
 }
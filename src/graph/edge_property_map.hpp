@@ -0,0 +1,166 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef GRAPH__EDGE_PROPERTY_MAP__HPP
+#define GRAPH__EDGE_PROPERTY_MAP__HPP
+
+#include <limits>
+#include <vector>
+#include <graph/edge.hpp>
+#include <graph/neighbors.hpp>
+
+namespace graph
+{
+/// Stores a value for each edge of a graph in a contiguous container.
+///
+/// Each edge gets a dense id, determined by the order in which the graph
+/// enumerates its edges: the outgoing edges of vertex `u` have the ids
+/// `offset(u)` up to (excluding) `offset(u + 1)`, in the order the outgoing
+/// vertices of `u` are enumerated. The algorithms access the values by id
+/// while iterating over the outgoing vertices, which avoids lookups
+/// (tree or hash) for every edge.
+///
+/// The ids are only valid as long as the graph is not modified.
+///
+/// Example:
+/// \code
+///   const adjlist g{3, {{0, 1}, {0, 2}, {1, 2}}};
+///   edge_property_map<int> p{g};
+///   p.set(g, {0, 1}, 4);
+///   p.set(g, {0, 2}, 2);
+///   p.set(g, {1, 2}, 1);
+///   auto const path = shortest_path_dijkstra(g, p, 0, 2);
+/// \endcode
+///
+/// \tparam T The type of the values
+///
+template <class T> class edge_property_map
+{
+public:
+	using size_type = std::size_t;
+	using mapped_type = T;
+
+	enum : size_type { npos = std::numeric_limits<size_type>::max() };
+
+private:
+	std::vector<size_type> offsets; // first id of each vertex, plus total number of edges
+	std::vector<mapped_type> values;
+
+public:
+	/// \{
+	/// Creates the map for all edges of the specified graph, all values
+	/// are initialized with the specified one.
+	///
+	/// Complexity: O(n + m)
+	///
+	/// \tparam Graph The graph type, must be traversable (see `for_each_outgoing`).
+	/// \param[in] g The graph
+	/// \param[in] value The value to initialize all edges with
+	template <class Graph>
+	explicit edge_property_map(const Graph & g, const mapped_type & value = mapped_type{})
+		: offsets(g.size() + 1, 0)
+	{
+		for (vertex u = 0; u < g.size(); ++u) {
+			size_type d = 0;
+			detail::for_each_outgoing(g, u, [&d](vertex) { ++d; });
+			offsets[u + 1] = offsets[u] + d;
+		}
+		values.assign(offsets.back(), value);
+	}
+
+	edge_property_map(const edge_property_map &) = default;
+	edge_property_map(edge_property_map &&) = default;
+	/// \}
+
+	/// \{
+	edge_property_map & operator=(const edge_property_map &) = default;
+	edge_property_map & operator=(edge_property_map &&) = default;
+	/// \}
+
+	/// \{
+	/// Returns the number of edges, i.e. the number of values.
+	size_type size() const noexcept { return values.size(); }
+
+	/// Returns the id of the first outgoing edge of the specified vertex.
+	///
+	/// This function is not boundary checked.
+	///
+	/// Complexity: O(1)
+	size_type offset(vertex u) const { return offsets[u]; }
+
+	/// Returns the id of the specified edge, or `npos` if the graph does
+	/// not contain the edge.
+	///
+	/// Complexity: O(d) for graphs with cheap access to outgoing vertices, O(n) otherwise
+	template <class Graph> size_type id(const Graph & g, edge e) const
+	{
+		if ((e.from >= g.size()) || (e.from + 1 >= offsets.size()))
+			return npos;
+		size_type i = offsets[e.from];
+		size_type result = npos;
+		detail::for_each_outgoing(g, e.from, [&](vertex v) {
+			if ((v == e.to) && (result == npos))
+				result = i;
+			++i;
+		});
+		return result;
+	}
+	/// \}
+
+	/// \{
+	/// Access to the value of the edge with the specified id.
+	///
+	/// This function is not boundary checked.
+	///
+	/// Complexity: O(1)
+	mapped_type & operator[](size_type id) { return values[id]; }
+
+	/// \see operator[]()
+	const mapped_type & operator[](size_type id) const { return values[id]; }
+
+	/// Sets the value of the specified edge.
+	///
+	/// Complexity: see id()
+	///
+	/// \return true on success, false if the graph does not contain the edge.
+	template <class Graph> bool set(const Graph & g, edge e, const mapped_type & value)
+	{
+		auto const i = id(g, e);
+		if (i == npos)
+			return false;
+		values[i] = value;
+		return true;
+	}
+	/// \}
+};
+}
+
+#endif
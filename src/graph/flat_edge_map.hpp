@@ -0,0 +1,345 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef GRAPH__FLAT_EDGE_MAP__HPP
+#define GRAPH__FLAT_EDGE_MAP__HPP
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <graph/edge.hpp>
+
+namespace graph
+{
+/// Hash map with edges as keys, using open addressing with linear probing.
+///
+/// Keys and values are stored together in one flat array, a lookup touches
+/// usually one or two consecutive slots instead of following the chain of
+/// nodes of `std::unordered_map`. The capacity is always a power of two, the
+/// load factor is kept below 3/4.
+///
+/// The map satisfies the requirements of the property maps of the algorithms
+/// (`mapped_type`, `const_iterator`, `find`, `end`) and may be used instead of
+/// `std::map<edge, T>` or `std::unordered_map<edge, T, edge_hash>`.
+///
+/// Edges with `vertex_invalid` as starting vertex cannot be stored, this
+/// value marks empty slots.
+///
+/// Iterators are invalidated by insertion and removal of elements.
+///
+/// \tparam T The type of the values
+/// \tparam Hash The hash function for edges, must mix all bits well
+///
+template <class T, class Hash = edge_hash> class flat_edge_map
+{
+public:
+	using key_type = edge;
+	using mapped_type = T;
+	using size_type = std::size_t;
+
+private:
+	struct slot {
+		vertex from;
+		vertex to;
+		mapped_type value;
+	};
+
+	std::vector<slot> slots;
+	size_type n = 0; // number of elements
+	Hash hash;
+
+	size_type mask() const noexcept { return slots.size() - 1; }
+
+	/// Returns the slot of the specified key or the empty slot where it
+	/// would be inserted. The table must not be empty.
+	size_type probe(const key_type & k) const
+	{
+		size_type i = hash(k) & mask();
+		while ((slots[i].from != vertex_invalid)
+			&& ((slots[i].from != k.from) || (slots[i].to != k.to)))
+			i = (i + 1) & mask();
+		return i;
+	}
+
+	void rehash(size_type capacity)
+	{
+		std::vector<slot> old(capacity, empty_slot());
+		old.swap(slots);
+		for (auto & s : old) {
+			if (s.from == vertex_invalid)
+				continue;
+			slots[probe({s.from, s.to})] = std::move(s);
+		}
+	}
+
+	static slot empty_slot() { return {vertex_invalid, vertex_invalid, mapped_type{}}; }
+
+	/// Returns the smallest capacity which holds the specified number
+	/// of elements without exceeding the maximum load factor.
+	static size_type capacity_for(size_type size)
+	{
+		size_type c = 8;
+		while (4 * size >= 3 * c)
+			c *= 2;
+		return c;
+	}
+
+	template <class Map, class Reference> class basic_iterator
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = std::pair<key_type, mapped_type>;
+		using difference_type = std::ptrdiff_t;
+		using reference = std::pair<key_type, Reference>;
+
+		/// Makes `i->second` possible, even though the elements are not
+		/// stored as pairs.
+		struct pointer {
+			reference r;
+			const reference * operator->() const { return &r; }
+		};
+
+	private:
+		Map * m = nullptr;
+		size_type i = 0;
+
+		void skip_empty()
+		{
+			while ((i < m->slots.size()) && (m->slots[i].from == vertex_invalid))
+				++i;
+		}
+
+	public:
+		basic_iterator() = default;
+
+		basic_iterator(Map * m, size_type i)
+			: m(m)
+			, i(i)
+		{
+			skip_empty();
+		}
+
+		reference operator*() const
+		{
+			auto & s = m->slots[i];
+			return {{s.from, s.to}, s.value};
+		}
+
+		pointer operator->() const { return {**this}; }
+
+		basic_iterator & operator++()
+		{
+			++i;
+			skip_empty();
+			return *this;
+		}
+
+		basic_iterator operator++(int)
+		{
+			auto const t = *this;
+			++*this;
+			return t;
+		}
+
+		friend bool operator==(const basic_iterator & a, const basic_iterator & b)
+		{
+			return (a.m == b.m) && (a.i == b.i);
+		}
+
+		friend bool operator!=(const basic_iterator & a, const basic_iterator & b)
+		{
+			return !(a == b);
+		}
+	};
+
+public:
+	using iterator = basic_iterator<flat_edge_map, mapped_type &>;
+	using const_iterator = basic_iterator<const flat_edge_map, const mapped_type &>;
+
+	/// \{
+	/// Constructs an empty map.
+	flat_edge_map() = default;
+
+	/// Constructs an empty map with space for the specified number of elements.
+	explicit flat_edge_map(size_type capacity) { reserve(capacity); }
+
+	/// Constructs the map with the specified elements. For duplicate keys
+	/// only the first element is inserted.
+	flat_edge_map(std::initializer_list<std::pair<key_type, mapped_type>> elements)
+		: flat_edge_map(elements.size())
+	{
+		for (auto const & e : elements)
+			insert(e.first, e.second);
+	}
+
+	flat_edge_map(const flat_edge_map &) = default;
+	flat_edge_map(flat_edge_map &&) = default;
+	/// \}
+
+	/// \{
+	flat_edge_map & operator=(const flat_edge_map &) = default;
+	flat_edge_map & operator=(flat_edge_map &&) = default;
+	/// \}
+
+	/// \{
+	/// Returns the number of elements.
+	size_type size() const noexcept { return n; }
+
+	/// Returns true if the map contains no elements.
+	bool empty() const noexcept { return n == 0; }
+
+	/// Returns the number of slots.
+	size_type capacity() const noexcept { return slots.size(); }
+
+	/// Allocates space for at least the specified number of elements.
+	///
+	/// Complexity: O(capacity)
+	void reserve(size_type size)
+	{
+		auto const c = capacity_for(size);
+		if (c > slots.size())
+			rehash(c);
+	}
+
+	/// Removes all elements, the capacity remains.
+	///
+	/// Complexity: O(capacity)
+	void clear()
+	{
+		std::fill(std::begin(slots), std::end(slots), empty_slot());
+		n = 0;
+	}
+	/// \}
+
+	/// \{
+	iterator begin() { return {this, 0}; }
+	iterator end() { return {this, slots.size()}; }
+	const_iterator begin() const { return {this, 0}; }
+	const_iterator end() const { return {this, slots.size()}; }
+	/// \}
+
+	/// \{
+	/// Returns an iterator to the element with the specified key, or `end()`
+	/// if there is none.
+	///
+	/// Complexity: O(1) on average
+	iterator find(const key_type & k)
+	{
+		if (empty())
+			return end();
+		auto const i = probe(k);
+		return (slots[i].from == vertex_invalid) ? end() : iterator{this, i};
+	}
+
+	/// \see find()
+	const_iterator find(const key_type & k) const
+	{
+		if (empty())
+			return end();
+		auto const i = probe(k);
+		return (slots[i].from == vertex_invalid) ? end() : const_iterator{this, i};
+	}
+
+	/// Returns the number of elements with the specified key, 0 or 1.
+	size_type count(const key_type & k) const { return (find(k) != end()) ? 1 : 0; }
+	/// \}
+
+	/// \{
+	/// Inserts the element, if the key is not already present.
+	///
+	/// Complexity: O(1) on average
+	///
+	/// \return The iterator to the element with the key and `true` if it
+	///   was inserted, `false` if the key was already present.
+	std::pair<iterator, bool> insert(const key_type & k, const mapped_type & value)
+	{
+		if (k.from == vertex_invalid)
+			return {end(), false};
+		reserve(n + 1);
+		auto const i = probe(k);
+		if (slots[i].from != vertex_invalid)
+			return {iterator{this, i}, false};
+		slots[i] = slot{k.from, k.to, value};
+		++n;
+		return {iterator{this, i}, true};
+	}
+
+	/// Returns the value of the specified key, a default constructed
+	/// value is inserted if the key is not present.
+	///
+	/// Complexity: O(1) on average
+	///
+	/// \note The key must not have `vertex_invalid` as starting vertex.
+	mapped_type & operator[](const key_type & k)
+	{
+		reserve(n + 1);
+		auto const i = probe(k);
+		if (slots[i].from == vertex_invalid) {
+			slots[i] = slot{k.from, k.to, mapped_type{}};
+			++n;
+		}
+		return slots[i].value;
+	}
+
+	/// Removes the element with the specified key. The following elements
+	/// of the same probe sequence are shifted back, no tombstones remain.
+	///
+	/// Complexity: O(1) on average
+	///
+	/// \return The number of removed elements, 0 or 1.
+	size_type erase(const key_type & k)
+	{
+		if (empty())
+			return 0;
+		auto i = probe(k);
+		if (slots[i].from == vertex_invalid)
+			return 0;
+
+		for (auto j = (i + 1) & mask(); slots[j].from != vertex_invalid; j = (j + 1) & mask()) {
+			// move element `j` into the gap if its home slot is not
+			// cyclically within (i, j]
+			auto const home = hash({slots[j].from, slots[j].to}) & mask();
+			if (((j - home) & mask()) >= ((j - i) & mask())) {
+				slots[i] = std::move(slots[j]);
+				i = j;
+			}
+		}
+		slots[i] = empty_slot();
+		--n;
+		return 1;
+	}
+	/// \}
+};
+}
+
+#endif
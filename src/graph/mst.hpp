@@ -36,7 +36,9 @@
 #include <vector>
 #include <graph/edge.hpp>
 #include <graph/type_traits.hpp>
-#include <utils/priority_queue.hpp>
+#include <graph/weight.hpp>
+#include <utils/indexed_priority_queue.hpp>
+#include <utils/disjoint_set.hpp>
 
 namespace graph
 {
@@ -44,9 +46,13 @@ namespace graph
 namespace detail
 {
 /// Detail implementation of the minimum spanning tree.
-template <class Value, class Graph, class Accessor>
-edge_list minimum_spanning_tree_prim(const Graph & g, vertex start, Accessor access)
+///
+/// The weights of the edges are provided by `Weights`, see make_weights().
+template <class Graph, class Weights>
+edge_list minimum_spanning_tree_prim(const Graph & g, vertex start, const Weights & weights)
 {
+	using Value = typename Weights::value_type;
+
 	// prepare list of parents
 	vertex_list parent(g.size(), vertex_invalid);
 
@@ -55,23 +61,21 @@ edge_list minimum_spanning_tree_prim(const Graph & g, vertex start, Accessor acc
 	cost[start] = Value{};
 
 	// prepare priority queue
-	auto cmp = [&cost](vertex a, vertex b) -> bool { return cost[a] > cost[b]; };
-	utils::priority_queue<vertex, decltype(cmp)> q(cmp, g.vertices());
+	utils::indexed_priority_queue<Value> q(g.size());
+	for (vertex v = 0; v < g.size(); ++v)
+		q.push(v, cost[v]);
 
 	while (!q.empty()) {
 		vertex u = q.top();
 		q.pop();
 
-		for (auto const & v : g.outgoing(u)) {
-			if (std::find(std::begin(q), std::end(q), v) == std::end(q))
-				continue;
-			const Value alt = cost[u] + access({u, v});
-			if (alt < cost[v]) {
-				cost[v] = alt;
+		weights.for_each_outgoing(u, [&](vertex v, Value w) {
+			if (q.contains(v) && (w < cost[v])) {
+				cost[v] = w;
 				parent[v] = u;
-				q.update(); // priority criteria have been changed
+				q.decrease_key(v, w);
 			}
-		}
+		});
 	}
 
 	// fill edge list with tree
@@ -81,6 +85,41 @@ edge_list minimum_spanning_tree_prim(const Graph & g, vertex start, Accessor acc
 		tree.push_back({parent[v], v});
 	return tree;
 }
+
+/// Detail implementation of the minimum spanning tree, Kruskal's algorithm.
+///
+/// The weights of the edges are provided by `Weights`, see make_weights().
+template <class Graph, class Weights>
+edge_list minimum_spanning_tree_kruskal(const Graph & g, const Weights & weights)
+{
+	using Value = typename Weights::value_type;
+
+	// edges are not assignable, therefore sort weighted copies of them
+	struct weighted_edge {
+		vertex from;
+		vertex to;
+		Value weight;
+	};
+
+	std::vector<weighted_edge> candidates;
+	for (vertex u = 0; u < g.size(); ++u)
+		weights.for_each_outgoing(
+			u, [&](vertex v, Value w) { candidates.push_back({u, v, w}); });
+	std::stable_sort(std::begin(candidates), std::end(candidates),
+		[](const weighted_edge & a, const weighted_edge & b) { return a.weight < b.weight; });
+
+	// add edges which connect two distinct trees of the forest
+	utils::disjoint_set trees(g.size());
+	edge_list tree;
+	tree.reserve(g.size());
+	for (auto const & e : candidates) {
+		if (trees.count() == 1)
+			break;
+		if (trees.unite(e.from, e.to))
+			tree.emplace_back(e.from, e.to);
+	}
+	return tree;
+}
 }
 /// \endcond
 
@@ -88,9 +127,9 @@ edge_list minimum_spanning_tree_prim(const Graph & g, vertex start, Accessor acc
 /// The values of the edges must represent their weight and
 /// the graph must be bidirectional. The weight must be positive.
 ///
-/// This implementation is far from optimized. In fact it is
-/// a quite naive implementation. For demonstration purposes
-/// sufficient.
+/// The implementation uses an indexed priority queue, which supports
+/// to lower the cost of a vertex in `O(log n)` and to check whether
+/// a vertex is still in the queue in `O(1)`.
 ///
 /// \tparam Graph The graph type to visit.
 ///   Must provide the following features:
@@ -106,7 +145,7 @@ edge_list minimum_spanning_tree_prim(const Graph & g, vertex start, Accessor acc
 /// \param[in] start Starting node.
 /// \return A list of edges found for the minimum spanning tree.
 ///
-/// complexity: O(n log n)
+/// complexity: O((n + m) log n)
 ///
 template <class Graph,
 	typename = typename std::enable_if<detail::has_t_value_type<Graph>::value
@@ -116,19 +155,13 @@ template <class Graph,
 		void>::type>
 edge_list minimum_spanning_tree_prim(const Graph & g, vertex start)
 {
-	using Value = typename Graph::value_type;
-	return detail::minimum_spanning_tree_prim<Value>(
-		g, start, [&g](edge e) { return g.at(e); });
+	return detail::minimum_spanning_tree_prim(g, start, detail::make_weights(g));
 }
 
 /// Computes the miminum spanning tree of the specified graph.
 /// The values of the edges must represent their weight and
 /// the graph must be bidirectional. The weight must be positive.
 ///
-/// This implementation is far from optimized. In fact it is
-/// a quite naive implementation. For demonstration purposes
-/// sufficient.
-///
 /// Has the same properties (complexity, implementation) as minimum_spanning_tree_prim()
 ///
 /// \tparam Graph The graph type to visit.
@@ -143,6 +176,10 @@ edge_list minimum_spanning_tree_prim(const Graph & g, vertex start)
 ///   - type `const_iterator`
 ///   - function `const_iterator find(edge) const` returning an iterator (pair of key, value)
 ///   - function `const_iterator end() const` returning an iterator to the end of the container
+///   or, like `edge_property_map`:
+///   - type `mapped_type` which represents the distance type of an edge
+///   - function `size_type offset(vertex) const` returning the id of the first outgoing edge
+///   - function `mapped_type operator[](size_type) const` returning the value of an edge id
 ///
 /// \param[in] g The graph to generate the minimum spanning tree for.
 /// \param[in] start Starting node.
@@ -153,19 +190,82 @@ template <class Graph, class PropertyMap,
 	typename = typename std::enable_if<detail::has_t_size_type<Graph>::value
 			&& detail::has_f_size<Graph>::value && detail::has_f_vertices<Graph>::value
 			&& detail::has_f_outgoing<Graph>::value
-			&& detail::has_t_mapped_type<PropertyMap>::value
-			&& detail::has_t_const_iterator<PropertyMap>::value
-			&& detail::has_f_find<PropertyMap>::value && detail::has_f_end<PropertyMap>::value,
+			&& detail::is_edge_property_map<PropertyMap>::value,
 		void>::type>
 edge_list minimum_spanning_tree_prim(const Graph & g, const PropertyMap & p, vertex start)
 {
-	using Value = typename PropertyMap::mapped_type;
-	return detail::minimum_spanning_tree_prim<Value>(g, start, [&p](edge e) -> Value {
-		auto const i = p.find(e);
-		if (i != p.end())
-			return i->second;
-		return {};
-	});
+	return detail::minimum_spanning_tree_prim(g, start, detail::make_weights(g, p));
+}
+
+/// Computes the miminum spanning tree of the specified graph, using
+/// Kruskal's algorithm. The values of the edges must represent their weight.
+///
+/// All edges are sorted by their weight, then added to the tree in this order
+/// if they connect two yet unconnected parts, which is tracked by a disjoint set.
+/// This is usually faster than Prim's algorithm on sparse graphs.
+///
+/// In contrast to minimum_spanning_tree_prim() only the edges of the tree are
+/// returned, no entry for the root. If the graph is not connected, the
+/// result is a minimum spanning forest.
+///
+/// complexity: O(m log m)
+///
+/// \tparam Graph The graph type to visit.
+///   Must provide the following features:
+///   - type `value_type` which represents a single value within the graph (length of an edge)
+///   - type `size_type` which represents a size type for the graph
+///   - function `size_type size() const` which returns the number of nodes in the graph
+///   - function `vertex_list outgoing(vertex) const` which returns a `vertex_list` of all nodes
+///     reachable from the specified one
+///   - function `value_type at(edge) const` which returns the status of the specified edge.
+///
+/// \param[in] g The graph to generate the minimum spanning tree for.
+/// \return A list of edges found for the minimum spanning tree.
+///
+template <class Graph,
+	typename = typename std::enable_if<detail::has_t_value_type<Graph>::value
+			&& detail::has_t_size_type<Graph>::value && detail::has_f_size<Graph>::value
+			&& detail::has_f_at<Graph>::value && detail::has_f_outgoing<Graph>::value,
+		void>::type>
+edge_list minimum_spanning_tree_kruskal(const Graph & g)
+{
+	return detail::minimum_spanning_tree_kruskal(g, detail::make_weights(g));
+}
+
+/// Computes the miminum spanning tree of the specified graph, using
+/// Kruskal's algorithm. The distances of the edges are provided by a property map.
+///
+/// Has the same properties (complexity, implementation) as
+/// minimum_spanning_tree_kruskal()
+///
+/// \tparam Graph The graph type to visit.
+///   Must provide the following features:
+///   - function `size_type size() const` which returns the number of nodes in the graph
+///   - function `vertex_list outgoing(vertex) const` which returns a `vertex_list` of all nodes
+///     reachable from the specified one
+///
+/// \tparam PropertyMap The mapping of edge to distance, must provide following features:
+///   - type `mapped_type` which represents the distance type of an edge
+///   - type `const_iterator`
+///   - function `const_iterator find(edge) const` returning an iterator (pair of key, value)
+///   - function `const_iterator end() const` returning an iterator to the end of the container
+///   or, like `edge_property_map`:
+///   - type `mapped_type` which represents the distance type of an edge
+///   - function `size_type offset(vertex) const` returning the id of the first outgoing edge
+///   - function `mapped_type operator[](size_type) const` returning the value of an edge id
+///
+/// \param[in] g The graph to generate the minimum spanning tree for.
+/// \param[in] p The property mapping, containing the distances of the nodes
+/// \return A list of edges found for the minimum spanning tree.
+///
+template <class Graph, class PropertyMap,
+	typename = typename std::enable_if<detail::has_t_size_type<Graph>::value
+			&& detail::has_f_size<Graph>::value && detail::has_f_outgoing<Graph>::value
+			&& detail::is_edge_property_map<PropertyMap>::value,
+		void>::type>
+edge_list minimum_spanning_tree_kruskal(const Graph & g, const PropertyMap & p)
+{
+	return detail::minimum_spanning_tree_kruskal(g, detail::make_weights(g, p));
 }
 }
 
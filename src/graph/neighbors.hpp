@@ -0,0 +1,231 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef GRAPH__NEIGHBORS__HPP
+#define GRAPH__NEIGHBORS__HPP
+
+#include <algorithm>
+#include <type_traits>
+#include <graph/type_traits.hpp>
+#include <graph/edge.hpp>
+
+namespace graph
+{
+/// \cond DEV
+namespace detail
+{
+/// Strategies to enumerate the outgoing vertices of a vertex, ordered by preference.
+enum class neighbors_strategy {
+	outgoing_list, ///< `outgoing(vertex)` returns a newly created list
+	probe_at, ///< `at(edge)` is queried for every vertex of the graph
+	outgoing_view, ///< `outgoing(vertex)` returns a reference or view
+	member, ///< the graph provides `for_each_outgoing(vertex, Function)`
+	member_cursor, ///< the graph provides `next_outgoing(vertex, std::size_t &)`
+};
+
+/// Determines the preferred strategy to enumerate outgoing vertices.
+///
+/// Graphs with cheap access to their outgoing vertices (e.g. adjacency lists)
+/// are enumerated through them in `O(d)`. Matrix like graphs, which would have
+/// to scan a complete row to create the list anyway, are probed with `at(edge)`.
+template <class Graph> struct neighbors_strategy_of {
+	static constexpr neighbors_strategy value = has_f_for_each_outgoing<Graph>::value
+		? neighbors_strategy::member
+		: has_f_outgoing_view<Graph>::value
+			? neighbors_strategy::outgoing_view
+			: has_f_integral_type_at<Graph>::value ? neighbors_strategy::probe_at
+												   : neighbors_strategy::outgoing_list;
+};
+
+/// Checks if the outgoing vertices of the graph can be enumerated at all.
+template <class Graph> struct is_traversable {
+	enum {
+		value = has_t_size_type<Graph>::value && has_f_size<Graph>::value
+			&& (has_f_for_each_outgoing<Graph>::value || has_f_outgoing<Graph>::value
+				   || has_f_integral_type_at<Graph>::value)
+	};
+};
+
+template <class Graph, class Function>
+void for_each_outgoing(const Graph & g, vertex u, Function && f,
+	std::integral_constant<neighbors_strategy, neighbors_strategy::member>)
+{
+	g.for_each_outgoing(u, f);
+}
+
+template <class Graph, class Function>
+void for_each_outgoing(const Graph & g, vertex u, Function && f,
+	std::integral_constant<neighbors_strategy, neighbors_strategy::outgoing_view>)
+{
+	for (auto const v : g.outgoing(u))
+		f(v);
+}
+
+template <class Graph, class Function>
+void for_each_outgoing(const Graph & g, vertex u, Function && f,
+	std::integral_constant<neighbors_strategy, neighbors_strategy::probe_at>)
+{
+	for (vertex v = 0; v < g.size(); ++v)
+		if (g.at({u, v}))
+			f(v);
+}
+
+template <class Graph, class Function>
+void for_each_outgoing(const Graph & g, vertex u, Function && f,
+	std::integral_constant<neighbors_strategy, neighbors_strategy::outgoing_list>)
+{
+	for (auto const v : g.outgoing(u))
+		f(v);
+}
+
+/// Calls the specified function for each outgoing vertex of the vertex `u`,
+/// using the most efficient way the graph provides.
+///
+/// Complexity: O(d) for graphs with cheap access to outgoing vertices, O(n) otherwise
+template <class Graph, class Function>
+void for_each_outgoing(const Graph & g, vertex u, Function && f)
+{
+	for_each_outgoing(g, u, f,
+		std::integral_constant<neighbors_strategy, neighbors_strategy_of<Graph>::value>{});
+}
+
+/// Determines the strategy to enumerate outgoing vertices step by step, see
+/// next_outgoing(). Graphs providing a resumable enumeration themselves (e.g.
+/// `bitmatrix`, word by word) are preferred. Graphs whose enumeration is not
+/// resumable (`outgoing(vertex)` creating a new list, or only
+/// `for_each_outgoing`) are enumerated once into a buffer (strategy `member`).
+template <class Graph> struct cursor_strategy_of {
+	static constexpr neighbors_strategy value = has_f_next_outgoing<Graph>::value
+		? neighbors_strategy::member_cursor
+		: has_f_outgoing_view<Graph>::value
+			? neighbors_strategy::outgoing_view
+			: has_f_integral_type_at<Graph>::value ? neighbors_strategy::probe_at
+												   : neighbors_strategy::member;
+};
+
+template <class Graph, neighbors_strategy Strategy>
+std::size_t begin_outgoing(
+	const Graph &, vertex, vertex_list &, std::integral_constant<neighbors_strategy, Strategy>)
+{
+	return 0;
+}
+
+template <class Graph>
+std::size_t begin_outgoing(const Graph & g, vertex u, vertex_list & buffer,
+	std::integral_constant<neighbors_strategy, neighbors_strategy::member>)
+{
+	// reversed, the next vertex is at the end of the buffer
+	const auto first = buffer.size();
+	for_each_outgoing(g, u, [&buffer](vertex v) { buffer.push_back(v); });
+	std::reverse(std::begin(buffer) + static_cast<std::ptrdiff_t>(first), std::end(buffer));
+	return buffer.size() - first;
+}
+
+template <class Graph>
+vertex next_outgoing(const Graph & g, vertex u, std::size_t & cursor, vertex_list &,
+	std::integral_constant<neighbors_strategy, neighbors_strategy::member_cursor>)
+{
+	return g.next_outgoing(u, cursor);
+}
+
+template <class Graph>
+vertex next_outgoing(const Graph & g, vertex u, std::size_t & cursor, vertex_list &,
+	std::integral_constant<neighbors_strategy, neighbors_strategy::outgoing_view>)
+{
+	auto const & out = g.outgoing(u);
+	if (cursor >= static_cast<std::size_t>(std::end(out) - std::begin(out)))
+		return vertex_invalid;
+	return *(std::begin(out) + cursor++);
+}
+
+template <class Graph>
+vertex next_outgoing(const Graph & g, vertex u, std::size_t & cursor, vertex_list &,
+	std::integral_constant<neighbors_strategy, neighbors_strategy::probe_at>)
+{
+	for (; cursor < g.size(); ++cursor)
+		if (g.at({u, cursor}))
+			return cursor++;
+	return vertex_invalid;
+}
+
+template <class Graph>
+vertex next_outgoing(const Graph &, vertex, std::size_t & cursor, vertex_list & buffer,
+	std::integral_constant<neighbors_strategy, neighbors_strategy::member>)
+{
+	// the cursor counts the remaining vertices
+	if (cursor == 0)
+		return vertex_invalid;
+	--cursor;
+	const vertex v = buffer.back();
+	buffer.pop_back();
+	return v;
+}
+
+/// Starts the step by step enumeration of the outgoing vertices of the vertex
+/// `u` and returns the initial cursor for next_outgoing().
+///
+/// For graphs which are not resumable, all outgoing vertices are appended
+/// to the buffer, which is shared by all enumerations in progress. Therefore
+/// enumerations must be nested: an enumeration started later has to be
+/// finished (next_outgoing() returned `vertex_invalid`) before an earlier one
+/// is continued, as in depth first search. The buffer is not used (and not
+/// allocated) for other graphs.
+///
+/// Complexity: O(1), O(d) for graphs which are not resumable
+template <class Graph>
+std::size_t begin_outgoing(const Graph & g, vertex u, vertex_list & buffer)
+{
+	return begin_outgoing(g, u, buffer,
+		std::integral_constant<neighbors_strategy, cursor_strategy_of<Graph>::value>{});
+}
+
+/// Returns the next outgoing vertex of the vertex `u`, in the same order as
+/// for_each_outgoing(), or `vertex_invalid` if there are no more. The cursor
+/// keeps track of the progress, it must be initialized by begin_outgoing().
+///
+/// This makes it possible to interrupt the enumeration and resume it
+/// later, e.g. for depth first search without recursion.
+///
+/// Complexity: in total for all calls on a vertex: O(d) for graphs providing
+///   a view to outgoing vertices and for graphs which are not resumable (the
+///   vertices were buffered by begin_outgoing()), O(n / 64 + d) for `bitmatrix`,
+///   O(n) for matrix like graphs.
+template <class Graph>
+vertex next_outgoing(const Graph & g, vertex u, std::size_t & cursor, vertex_list & buffer)
+{
+	return next_outgoing(g, u, cursor, buffer,
+		std::integral_constant<neighbors_strategy, cursor_strategy_of<Graph>::value>{});
+}
+}
+/// \endcond
+}
+
+#endif
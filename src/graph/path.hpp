@@ -32,66 +32,344 @@
 #define GRAPH__PATH__HPP
 
 #include <algorithm>
+#include <limits>
 #include <tuple>
 #include <vector>
 #include <graph/type_traits.hpp>
 #include <graph/edge.hpp>
-#include <utils/priority_queue.hpp>
+#include <graph/weight.hpp>
+#include <graph/dijkstra_workspace.hpp>
 
 namespace graph
 {
+/// Result of a single source shortest path search: the distances of all
+/// vertices from the start and the tree of shortest paths, represented
+/// by the predecessor of each vertex.
+///
+/// \tparam Value The type of the distances
+template <class Value> struct shortest_path_tree {
+	/// Distance of vertices which are not reachable from the start.
+	static constexpr Value infinity = std::numeric_limits<Value>::max();
+
+	/// The start vertex of the search.
+	vertex start = vertex_invalid;
+
+	/// Distance of each vertex, `infinity` if not reachable.
+	std::vector<Value> distance;
+
+	/// Predecessor of each vertex, `vertex_invalid` for the start and for
+	/// vertices not reachable.
+	vertex_list predecessor;
+
+	/// Returns true if the specified vertex is reachable from the start.
+	bool reachable(vertex v) const
+	{
+		return (v < distance.size()) && (distance[v] != infinity);
+	}
+
+	/// Returns the path from the start to the specified vertex (inclusive),
+	/// or an empty list if the vertex is not reachable.
+	///
+	/// Complexity: O(length of the path)
+	vertex_list path(vertex destination) const
+	{
+		vertex_list v;
+		if (!reachable(destination))
+			return v;
+		for (vertex u = destination; u != vertex_invalid; u = predecessor[u])
+			v.push_back(u);
+		std::reverse(std::begin(v), std::end(v));
+		return v;
+	}
+};
+
+template <class Value> constexpr Value shortest_path_tree<Value>::infinity;
+
 /// \cond DEV
 namespace detail
 {
-/// Detail implementation of the shortest path finding algorithm.
-template <class Value, class Graph, class Accessor>
-std::tuple<vertex_list, bool> shortest_path_dijkstra(
-	const Graph & g, Accessor access, vertex start, vertex destination)
+/// Searches the shortest paths from the start vertex, until the destination
+/// is settled or, if the destination is `vertex_invalid`, until all reachable
+/// vertices are settled. Distances and predecessors are left in the workspace.
+///
+/// The weights of the edges are provided by `Weights`, see make_weights().
+template <class Weights>
+void dijkstra_search(const Weights & weights, vertex start, vertex destination,
+	dijkstra_workspace<typename Weights::value_type> & ws)
 {
-	// prepare list of predecessors
-	constexpr vertex undefined = vertex_invalid;
-	vertex_list predecessor(g.size(), undefined);
+	using Value = typename Weights::value_type;
 
-	// prepare list of distances
-	std::vector<Value> distance(g.size(), std::numeric_limits<Value>::max());
-	distance[start] = Value{};
+	ws.reset();
+	ws.set(start, Value{}, vertex_invalid);
 
-	// prepare priority queue
-	auto cmp = [&distance](vertex a, vertex b) -> bool { return distance[a] > distance[b]; };
-	utils::priority_queue<vertex, decltype(cmp)> q(cmp, g.vertices());
+	// vertices enter the queue when they are reached for the first time,
+	// the queue contains only the frontier of the search
+	auto & q = ws.queue();
+	q.push(start, Value{});
 
-	vertex u = undefined;
 	while (!q.empty()) {
-		u = q.top();
+		const vertex u = q.top();
 		q.pop();
 
 		if (u == destination)
 			break;
 
-		for (auto const & v : g.outgoing(u)) {
-			const Value alt = distance[u] + access({u, v});
-			if (alt < distance[v]) {
-				distance[v] = alt;
-				predecessor[v] = u;
-				q.update(); // priority criteria have been changed
+		const Value du = ws.distance(u);
+		weights.for_each_outgoing(u, [&](vertex v, Value w) {
+			const Value alt = du + w;
+			if (alt < ws.distance(v)) {
+				ws.set(v, alt, u);
+				if (q.contains(v)) {
+					q.decrease_key(v, alt);
+				} else {
+					q.push(v, alt);
+				}
 			}
-		}
+		});
 	}
+}
+
+/// Detail implementation of the shortest path finding algorithm.
+///
+/// The path is written to `path`, which is empty if there is no path.
+template <class Graph, class Weights>
+bool shortest_path_dijkstra(const Graph & g, const Weights & weights, vertex start,
+	vertex destination, dijkstra_workspace<typename Weights::value_type> & ws,
+	vertex_list & path)
+{
+	path.clear();
+	if ((start >= g.size()) || (destination >= g.size()) || (ws.size() < g.size()))
+		return false;
+
+	dijkstra_search(weights, start, destination, ws);
+
+	// path may not exist
+	if (!ws.reached(destination))
+		return false;
 
 	// create path
-	vertex_list path;
-	while ((u != start) && (u != undefined)) {
+	for (vertex u = destination; u != vertex_invalid; u = ws.predecessor(u))
+		path.push_back(u);
+	std::reverse(std::begin(path), std::end(path));
+	return true;
+}
+
+/// Settles the vertex on top of the queue of one direction of the bidirectional
+/// search and relaxes its edges, using `for_each_edge(vertex, Function)` to
+/// enumerate them. Whenever an edge reaches a vertex already reached by the
+/// other direction, the length of the path through this edge is a candidate
+/// for the shortest path.
+template <class Value, class EdgeEnumerator>
+void bidirectional_dijkstra_step(dijkstra_workspace<Value> & ws,
+	const dijkstra_workspace<Value> & other, EdgeEnumerator for_each_edge, Value & best,
+	vertex & meet)
+{
+	auto & q = ws.queue();
+	const vertex u = q.top();
+	q.pop();
+
+	const Value du = ws.distance(u);
+	for_each_edge(u, [&](vertex v, Value w) {
+		const Value alt = du + w;
+		if (alt < ws.distance(v)) {
+			ws.set(v, alt, u);
+			if (q.contains(v)) {
+				q.decrease_key(v, alt);
+			} else {
+				q.push(v, alt);
+			}
+		}
+		if (other.reached(v) && (ws.distance(v) + other.distance(v) < best)) {
+			best = ws.distance(v) + other.distance(v);
+			meet = v;
+		}
+	});
+}
+
+/// Detail implementation of the bidirectional shortest path finding algorithm.
+///
+/// The path is written to `path`, which is empty if there is no path.
+template <class Graph, class Weights>
+bool shortest_path_bidirectional_dijkstra(const Graph & g, const Weights & weights,
+	vertex start, vertex destination, dijkstra_workspace<typename Weights::value_type> & fw,
+	dijkstra_workspace<typename Weights::value_type> & bw, vertex_list & path)
+{
+	using Value = typename Weights::value_type;
+	constexpr Value infinity = dijkstra_workspace<Value>::infinity;
+
+	path.clear();
+	if ((start >= g.size()) || (destination >= g.size()) || (fw.size() < g.size())
+		|| (bw.size() < g.size()))
+		return false;
+
+	// forward search from the start, backward search from the destination
+	fw.reset();
+	fw.set(start, Value{}, vertex_invalid);
+	fw.queue().push(start, Value{});
+	bw.reset();
+	bw.set(destination, Value{}, vertex_invalid);
+	bw.queue().push(destination, Value{});
+
+	Value best = (start == destination) ? Value{} : infinity;
+	vertex meet = (start == destination) ? start : vertex_invalid;
+
+	auto const forward = [&weights](vertex u, auto && f) { weights.for_each_outgoing(u, f); };
+	auto const backward = [&weights](vertex u, auto && f) { weights.for_each_incoming(u, f); };
+
+	// if one of the searches runs out of vertices, all paths are known
+	while (!fw.queue().empty() && !bw.queue().empty()) {
+		const Value top_fw = fw.queue().top_priority();
+		const Value top_bw = bw.queue().top_priority();
+
+		// no path through unsettled vertices can be shorter
+		if ((best != infinity) && (top_fw + top_bw >= best))
+			break;
+
+		// expand the search which is less advanced
+		if (top_fw <= top_bw) {
+			bidirectional_dijkstra_step(fw, bw, forward, best, meet);
+		} else {
+			bidirectional_dijkstra_step(bw, fw, backward, best, meet);
+		}
+	}
+
+	if (meet == vertex_invalid)
+		return false;
+
+	// create path: forward tree from the start to the meeting vertex,
+	// backward tree from there to the destination
+	for (vertex u = meet; u != vertex_invalid; u = fw.predecessor(u))
+		path.push_back(u);
+	std::reverse(std::begin(path), std::end(path));
+	for (vertex u = bw.predecessor(meet); u != vertex_invalid; u = bw.predecessor(u))
 		path.push_back(u);
-		u = predecessor[u];
+	return true;
+}
+
+/// Runs the bidirectional shortest path finding algorithm with temporary workspaces.
+template <class Graph, class Weights>
+std::tuple<vertex_list, bool> shortest_path_bidirectional_dijkstra(
+	const Graph & g, const Weights & weights, vertex start, vertex destination)
+{
+	dijkstra_workspace<typename Weights::value_type> fw(g.size());
+	dijkstra_workspace<typename Weights::value_type> bw(g.size());
+	vertex_list path;
+	const bool found
+		= shortest_path_bidirectional_dijkstra(g, weights, start, destination, fw, bw, path);
+	return std::make_tuple(path, found);
+}
+
+/// Detail implementation of the single source shortest paths.
+template <class Graph, class Weights>
+shortest_path_tree<typename Weights::value_type> shortest_paths_dijkstra(
+	const Graph & g, const Weights & weights, vertex start)
+{
+	using Value = typename Weights::value_type;
+
+	shortest_path_tree<Value> tree;
+	if (start >= g.size())
+		return tree;
+
+	dijkstra_workspace<Value> ws(g.size());
+	dijkstra_search(weights, start, vertex_invalid, ws);
+
+	tree.start = start;
+	tree.distance.reserve(g.size());
+	tree.predecessor.reserve(g.size());
+	for (vertex v = 0; v < g.size(); ++v) {
+		tree.distance.push_back(ws.distance(v));
+		tree.predecessor.push_back(ws.predecessor(v));
 	}
+	return tree;
+}
+
+/// Runs the shortest path finding algorithm with a temporary workspace.
+template <class Graph, class Weights>
+std::tuple<vertex_list, bool> shortest_path_dijkstra(
+	const Graph & g, const Weights & weights, vertex start, vertex destination)
+{
+	dijkstra_workspace<typename Weights::value_type> ws(g.size());
+	vertex_list path;
+	const bool found = shortest_path_dijkstra(g, weights, start, destination, ws, path);
+	return std::make_tuple(path, found);
+}
+
+/// Searches the shortest path from the start vertex to the destination, guided
+/// by the heuristic: vertices are settled in the order of their distance from
+/// the start plus the estimated distance `heuristic(vertex)` to the destination.
+/// Distances and predecessors are left in the workspace.
+///
+/// A vertex whose distance is lowered after it was settled, which happens only
+/// for heuristics which are not consistent, is inserted into the queue again.
+template <class Weights, class Heuristic>
+void astar_search(const Weights & weights, const Heuristic & heuristic, vertex start,
+	vertex destination, dijkstra_workspace<typename Weights::value_type> & ws)
+{
+	using Value = typename Weights::value_type;
+
+	ws.reset();
+	ws.set(start, Value{}, vertex_invalid);
+
+	auto & q = ws.queue();
+	q.push(start, static_cast<Value>(heuristic(start)));
+
+	while (!q.empty()) {
+		const vertex u = q.top();
+		q.pop();
+
+		if (u == destination)
+			break;
+
+		const Value du = ws.distance(u);
+		weights.for_each_outgoing(u, [&](vertex v, Value w) {
+			const Value alt = du + w;
+			if (alt < ws.distance(v)) {
+				ws.set(v, alt, u);
+				const Value estimate = alt + static_cast<Value>(heuristic(v));
+				if (q.contains(v)) {
+					q.decrease_key(v, estimate);
+				} else {
+					q.push(v, estimate);
+				}
+			}
+		});
+	}
+}
+
+/// Detail implementation of the A* shortest path finding algorithm.
+///
+/// The path is written to `path`, which is empty if there is no path.
+template <class Graph, class Weights, class Heuristic>
+bool shortest_path_astar(const Graph & g, const Weights & weights, vertex start,
+	vertex destination, const Heuristic & heuristic,
+	dijkstra_workspace<typename Weights::value_type> & ws, vertex_list & path)
+{
+	path.clear();
+	if ((start >= g.size()) || (destination >= g.size()) || (ws.size() < g.size()))
+		return false;
+
+	astar_search(weights, heuristic, start, destination, ws);
 
 	// path may not exist
-	if (u == undefined)
-		return std::make_tuple(vertex_list{}, false);
+	if (!ws.reached(destination))
+		return false;
 
-	path.push_back(u);
+	// create path
+	for (vertex u = destination; u != vertex_invalid; u = ws.predecessor(u))
+		path.push_back(u);
 	std::reverse(std::begin(path), std::end(path));
-	return std::make_tuple(path, true);
+	return true;
+}
+
+/// Runs the A* shortest path finding algorithm with a temporary workspace.
+template <class Graph, class Weights, class Heuristic>
+std::tuple<vertex_list, bool> shortest_path_astar(const Graph & g, const Weights & weights,
+	vertex start, vertex destination, const Heuristic & heuristic)
+{
+	dijkstra_workspace<typename Weights::value_type> ws(g.size());
+	vertex_list path;
+	const bool found = shortest_path_astar(g, weights, start, destination, heuristic, ws, path);
+	return std::make_tuple(path, found);
 }
 }
 /// \endcond
@@ -100,10 +378,17 @@ std::tuple<vertex_list, bool> shortest_path_dijkstra(
 /// node within the specified graph. If the destination is not reachable,
 /// the second return value will indicate this with being \c false.
 ///
-/// This implementation is not optimized, also it is a rather naive implementation,
-/// but sufficient for demonstration. At least it uses a priority queue.
+/// The implementation uses an indexed priority queue, which supports
+/// to lower the distance of a vertex in `O(log n)`. Vertices are inserted
+/// into the queue when they are reached, the search stops as soon as the
+/// destination is settled. Therefore the complexity depends on the part of
+/// the graph closer to the start than the destination, not on the whole graph.
+///
+/// Graphs which store the values next to the outgoing vertices, i.e. provide
+/// `weights(vertex)` (like `weighted_adjlist`), are read without calling
+/// `at(edge)` for every edge.
 ///
-/// Complexity: O(n log n)
+/// Complexity: O((n + m) log n)
 ///
 /// \tparam Graph The graph type to visit.
 ///   Must provide the following features:
@@ -131,9 +416,7 @@ template <class Graph,
 std::tuple<vertex_list, bool> shortest_path_dijkstra(
 	const Graph & g, vertex start, vertex destination)
 {
-	using Value = typename Graph::value_type;
-	return detail::shortest_path_dijkstra<Value>(
-		g, [&g](edge e) { return g.at(e); }, start, destination);
+	return detail::shortest_path_dijkstra(g, detail::make_weights(g), start, destination);
 }
 
 /// This function does basically the same as shortest_path_dijkstra() with the
@@ -154,6 +437,10 @@ std::tuple<vertex_list, bool> shortest_path_dijkstra(
 ///   - type `const_iterator`
 ///   - function `const_iterator find(edge) const` returning an iterator (pair of key, value)
 ///   - function `const_iterator end() const` returning an iterator to the end of the container
+///   or, like `edge_property_map`:
+///   - type `mapped_type` which represents the distance type of an edge
+///   - function `size_type offset(vertex) const` returning the id of the first outgoing edge
+///   - function `mapped_type operator[](size_type) const` returning the value of an edge id
 ///
 /// \param[in] g The graph
 /// \param[in] p The property mapping, containing the distances of the nodes
@@ -167,20 +454,311 @@ template <class Graph, class PropertyMap,
 	typename = typename std::enable_if<detail::has_t_size_type<Graph>::value
 			&& detail::has_f_size<Graph>::value && detail::has_f_vertices<Graph>::value
 			&& detail::has_f_outgoing<Graph>::value
-			&& detail::has_t_mapped_type<PropertyMap>::value
-			&& detail::has_t_const_iterator<PropertyMap>::value
-			&& detail::has_f_find<PropertyMap>::value && detail::has_f_end<PropertyMap>::value,
+			&& detail::is_edge_property_map<PropertyMap>::value,
 		void>::type>
 std::tuple<vertex_list, bool> shortest_path_dijkstra(
 	const Graph & g, const PropertyMap & p, vertex start, vertex destination)
 {
-	using Value = typename PropertyMap::mapped_type;
-	return detail::shortest_path_dijkstra<Value>(g, [&p](edge e) -> Value {
-		auto const i = p.find(e);
-		if (i != p.end())
-			return i->second;
-		return {};
-	}, start, destination);
+	return detail::shortest_path_dijkstra(g, detail::make_weights(g, p), start, destination);
+}
+
+/// Finds the shortest path like shortest_path_dijkstra(), using the specified
+/// workspace instead of allocating memory. This is meant for many queries
+/// on the same graph: with a reused workspace and path, a query does not
+/// allocate memory.
+///
+/// Has the same properties (complexity, implementation) as shortest_path_dijkstra()
+///
+/// \tparam Graph The graph type to visit, see shortest_path_dijkstra()
+///
+/// \param[in] g The graph
+/// \param[in] start The staring node
+/// \param[in] destination The destination node
+/// \param[in,out] ws The workspace, must have at least the size of the graph.
+///   After the call it contains the distances of the vertices reached by the search.
+/// \param[out] path List of vertices from start to destination (inclusive),
+///   empty if the destination is not reachable.
+/// \return true if the destination is reachable, false otherwise
+///
+template <class Graph,
+	typename = typename std::enable_if<detail::has_t_value_type<Graph>::value
+			&& detail::has_t_size_type<Graph>::value && detail::has_f_size<Graph>::value
+			&& detail::has_f_at<Graph>::value && detail::has_f_vertices<Graph>::value
+			&& detail::has_f_outgoing<Graph>::value,
+		void>::type>
+bool shortest_path_dijkstra(const Graph & g, vertex start, vertex destination,
+	dijkstra_workspace<typename Graph::value_type> & ws, vertex_list & path)
+{
+	return detail::shortest_path_dijkstra(
+		g, detail::make_weights(g), start, destination, ws, path);
+}
+
+/// Finds the shortest path like shortest_path_dijkstra(), with the distances
+/// provided by a property map and using the specified workspace.
+///
+/// \see shortest_path_dijkstra(const Graph &, vertex, vertex, dijkstra_workspace &,
+///   vertex_list &)
+///
+template <class Graph, class PropertyMap,
+	typename = typename std::enable_if<detail::has_t_size_type<Graph>::value
+			&& detail::has_f_size<Graph>::value && detail::has_f_vertices<Graph>::value
+			&& detail::has_f_outgoing<Graph>::value
+			&& detail::is_edge_property_map<PropertyMap>::value,
+		void>::type>
+bool shortest_path_dijkstra(const Graph & g, const PropertyMap & p, vertex start,
+	vertex destination, dijkstra_workspace<typename PropertyMap::mapped_type> & ws,
+	vertex_list & path)
+{
+	return detail::shortest_path_dijkstra(
+		g, detail::make_weights(g, p), start, destination, ws, path);
+}
+
+/// Computes the shortest paths from the start to all vertices of the graph.
+/// In contrast to shortest_path_dijkstra() the search does not stop at a
+/// destination, the result contains the distances to all vertices and the
+/// tree of shortest paths, from which the path to any vertex can be
+/// extracted by shortest_path_tree::path().
+///
+/// Complexity: O((n + m) log n)
+///
+/// \tparam Graph The graph type to visit, see shortest_path_dijkstra()
+///
+/// \param[in] g The graph
+/// \param[in] start The staring node
+/// \return The distances and predecessors of all vertices. If the start
+///   vertex is invalid, the containers of the result are empty.
+///
+template <class Graph,
+	typename = typename std::enable_if<detail::has_t_value_type<Graph>::value
+			&& detail::has_t_size_type<Graph>::value && detail::has_f_size<Graph>::value
+			&& detail::has_f_at<Graph>::value && detail::has_f_vertices<Graph>::value
+			&& detail::has_f_outgoing<Graph>::value,
+		void>::type>
+shortest_path_tree<typename Graph::value_type> shortest_paths_dijkstra(
+	const Graph & g, vertex start)
+{
+	return detail::shortest_paths_dijkstra(g, detail::make_weights(g), start);
+}
+
+/// Computes the shortest paths from the start to all vertices of the graph,
+/// with the distances provided by a property map.
+///
+/// \see shortest_paths_dijkstra(const Graph &, vertex)
+///
+template <class Graph, class PropertyMap,
+	typename = typename std::enable_if<detail::has_t_size_type<Graph>::value
+			&& detail::has_f_size<Graph>::value && detail::has_f_vertices<Graph>::value
+			&& detail::has_f_outgoing<Graph>::value
+			&& detail::is_edge_property_map<PropertyMap>::value,
+		void>::type>
+shortest_path_tree<typename PropertyMap::mapped_type> shortest_paths_dijkstra(
+	const Graph & g, const PropertyMap & p, vertex start)
+{
+	return detail::shortest_paths_dijkstra(g, detail::make_weights(g, p), start);
+}
+
+/// Finds the shortest path from the start to the destination like
+/// shortest_path_dijkstra(), searching simultaneously forward from the start
+/// and backward from the destination. The search stops as soon as the sum of
+/// the smallest distances in both queues is not smaller than the shortest
+/// path found so far. For point to point queries this settles usually much
+/// fewer vertices than the unidirectional search, roughly two circles with
+/// half the radius instead of one.
+///
+/// The backward search needs the incoming edges of vertices, the graph should
+/// provide cheap access to them, like `bidirectional_adjlist`.
+///
+/// Complexity: O((n + m) log n), plus the access to incoming vertices
+///
+/// \tparam Graph The graph type to visit.
+///   Must provide the features listed for shortest_path_dijkstra() and:
+///   - function `vertex_list incoming(vertex) const` which returns a `vertex_list` of all
+///     vertices with an edge to the specified one
+///
+/// \param[in] g The graph
+/// \param[in] start The staring node
+/// \param[in] destination The destination node
+/// \return A tuple with the following information:
+///   - list of vertices from start to destination (inclusive)
+///   - status about success, if false: destination not reachable
+///
+template <class Graph,
+	typename = typename std::enable_if<detail::has_t_value_type<Graph>::value
+			&& detail::has_t_size_type<Graph>::value && detail::has_f_size<Graph>::value
+			&& detail::has_f_at<Graph>::value && detail::has_f_vertices<Graph>::value
+			&& detail::has_f_outgoing<Graph>::value && detail::has_f_incoming<Graph>::value,
+		void>::type>
+std::tuple<vertex_list, bool> shortest_path_bidirectional_dijkstra(
+	const Graph & g, vertex start, vertex destination)
+{
+	return detail::shortest_path_bidirectional_dijkstra(
+		g, detail::make_weights(g), start, destination);
+}
+
+/// Finds the shortest path like shortest_path_bidirectional_dijkstra(), with
+/// the distances of the edges provided by a property map.
+///
+/// \see shortest_path_bidirectional_dijkstra(const Graph &, vertex, vertex)
+///
+template <class Graph, class PropertyMap,
+	typename = typename std::enable_if<detail::has_t_size_type<Graph>::value
+			&& detail::has_f_size<Graph>::value && detail::has_f_vertices<Graph>::value
+			&& detail::has_f_outgoing<Graph>::value && detail::has_f_incoming<Graph>::value
+			&& detail::is_edge_property_map<PropertyMap>::value,
+		void>::type>
+std::tuple<vertex_list, bool> shortest_path_bidirectional_dijkstra(
+	const Graph & g, const PropertyMap & p, vertex start, vertex destination)
+{
+	return detail::shortest_path_bidirectional_dijkstra(
+		g, detail::make_weights(g, p), start, destination);
+}
+
+/// Finds the shortest path like shortest_path_bidirectional_dijkstra(), using
+/// the specified workspaces (one for each direction) instead of allocating
+/// memory, see shortest_path_dijkstra() with workspace.
+///
+/// \param[in] g The graph
+/// \param[in] start The staring node
+/// \param[in] destination The destination node
+/// \param[in,out] forward The workspace of the search from the start
+/// \param[in,out] backward The workspace of the search from the destination
+/// \param[out] path List of vertices from start to destination (inclusive),
+///   empty if the destination is not reachable.
+/// \return true if the destination is reachable, false otherwise
+///
+template <class Graph,
+	typename = typename std::enable_if<detail::has_t_value_type<Graph>::value
+			&& detail::has_t_size_type<Graph>::value && detail::has_f_size<Graph>::value
+			&& detail::has_f_at<Graph>::value && detail::has_f_vertices<Graph>::value
+			&& detail::has_f_outgoing<Graph>::value && detail::has_f_incoming<Graph>::value,
+		void>::type>
+bool shortest_path_bidirectional_dijkstra(const Graph & g, vertex start, vertex destination,
+	dijkstra_workspace<typename Graph::value_type> & forward,
+	dijkstra_workspace<typename Graph::value_type> & backward, vertex_list & path)
+{
+	return detail::shortest_path_bidirectional_dijkstra(
+		g, detail::make_weights(g), start, destination, forward, backward, path);
+}
+
+/// Finds the shortest path like shortest_path_bidirectional_dijkstra(), with
+/// the distances provided by a property map and using the specified workspaces.
+///
+/// \see shortest_path_bidirectional_dijkstra(const Graph &, vertex, vertex,
+///   dijkstra_workspace &, dijkstra_workspace &, vertex_list &)
+///
+template <class Graph, class PropertyMap,
+	typename = typename std::enable_if<detail::has_t_size_type<Graph>::value
+			&& detail::has_f_size<Graph>::value && detail::has_f_vertices<Graph>::value
+			&& detail::has_f_outgoing<Graph>::value && detail::has_f_incoming<Graph>::value
+			&& detail::is_edge_property_map<PropertyMap>::value,
+		void>::type>
+bool shortest_path_bidirectional_dijkstra(const Graph & g, const PropertyMap & p,
+	vertex start, vertex destination,
+	dijkstra_workspace<typename PropertyMap::mapped_type> & forward,
+	dijkstra_workspace<typename PropertyMap::mapped_type> & backward, vertex_list & path)
+{
+	return detail::shortest_path_bidirectional_dijkstra(
+		g, detail::make_weights(g, p), start, destination, forward, backward, path);
+}
+
+/// Finds the shortest path from the start to the destination like
+/// shortest_path_dijkstra(), guided by a heuristic which estimates the
+/// distance of a vertex to the destination (A* search). Vertices are settled
+/// in the order of their distance from the start plus their estimate, the
+/// search therefore heads towards the destination and settles only a
+/// fraction of the vertices Dijkstra does. A typical heuristic is the
+/// geometric distance between vertex coordinates.
+///
+/// The path is a shortest path if the heuristic never overestimates the
+/// distance to the destination (admissible). A heuristic which is also
+/// consistent, i.e. `heuristic(u) <= w(u, v) + heuristic(v)` for all edges,
+/// settles every vertex at most once. A heuristic returning always zero
+/// makes the search equal to shortest_path_dijkstra().
+///
+/// Complexity: O((n + m) log n)
+///
+/// \tparam Graph The graph type to visit, see shortest_path_dijkstra()
+/// \tparam Heuristic Callable `value_type heuristic(vertex)`, returning the
+///   estimated distance of the vertex to the destination.
+///
+/// \param[in] g The graph
+/// \param[in] start The staring node
+/// \param[in] destination The destination node
+/// \param[in] heuristic The estimate of the distance to the destination
+/// \return A tuple with the following information:
+///   - list of vertices from start to destination (inclusive)
+///   - status about success, if false: destination not reachable
+///
+template <class Graph, class Heuristic,
+	typename = typename std::enable_if<detail::has_t_value_type<Graph>::value
+			&& detail::has_t_size_type<Graph>::value && detail::has_f_size<Graph>::value
+			&& detail::has_f_at<Graph>::value && detail::has_f_vertices<Graph>::value
+			&& detail::has_f_outgoing<Graph>::value,
+		void>::type>
+std::tuple<vertex_list, bool> shortest_path_astar(
+	const Graph & g, vertex start, vertex destination, const Heuristic & heuristic)
+{
+	return detail::shortest_path_astar(
+		g, detail::make_weights(g), start, destination, heuristic);
+}
+
+/// Finds the shortest path like shortest_path_astar(), with the distances
+/// provided by a property map.
+///
+/// \see shortest_path_astar(const Graph &, vertex, vertex, const Heuristic &)
+/// \see shortest_path_dijkstra(const Graph &, const PropertyMap &, vertex, vertex)
+///
+template <class Graph, class PropertyMap, class Heuristic,
+	typename = typename std::enable_if<detail::has_t_size_type<Graph>::value
+			&& detail::has_f_size<Graph>::value && detail::has_f_vertices<Graph>::value
+			&& detail::has_f_outgoing<Graph>::value
+			&& detail::is_edge_property_map<PropertyMap>::value,
+		void>::type>
+std::tuple<vertex_list, bool> shortest_path_astar(const Graph & g, const PropertyMap & p,
+	vertex start, vertex destination, const Heuristic & heuristic)
+{
+	return detail::shortest_path_astar(
+		g, detail::make_weights(g, p), start, destination, heuristic);
+}
+
+/// Finds the shortest path like shortest_path_astar(), using the specified
+/// workspace instead of allocating memory.
+///
+/// \see shortest_path_dijkstra(const Graph &, vertex, vertex, dijkstra_workspace &,
+///   vertex_list &)
+///
+template <class Graph, class Heuristic,
+	typename = typename std::enable_if<detail::has_t_value_type<Graph>::value
+			&& detail::has_t_size_type<Graph>::value && detail::has_f_size<Graph>::value
+			&& detail::has_f_at<Graph>::value && detail::has_f_vertices<Graph>::value
+			&& detail::has_f_outgoing<Graph>::value,
+		void>::type>
+bool shortest_path_astar(const Graph & g, vertex start, vertex destination,
+	const Heuristic & heuristic, dijkstra_workspace<typename Graph::value_type> & ws,
+	vertex_list & path)
+{
+	return detail::shortest_path_astar(
+		g, detail::make_weights(g), start, destination, heuristic, ws, path);
+}
+
+/// Finds the shortest path like shortest_path_astar(), with the distances
+/// provided by a property map and using the specified workspace.
+///
+/// \see shortest_path_astar(const Graph &, vertex, vertex, const Heuristic &,
+///   dijkstra_workspace &, vertex_list &)
+///
+template <class Graph, class PropertyMap, class Heuristic,
+	typename = typename std::enable_if<detail::has_t_size_type<Graph>::value
+			&& detail::has_f_size<Graph>::value && detail::has_f_vertices<Graph>::value
+			&& detail::has_f_outgoing<Graph>::value
+			&& detail::is_edge_property_map<PropertyMap>::value,
+		void>::type>
+bool shortest_path_astar(const Graph & g, const PropertyMap & p, vertex start,
+	vertex destination, const Heuristic & heuristic,
+	dijkstra_workspace<typename PropertyMap::mapped_type> & ws, vertex_list & path)
+{
+	return detail::shortest_path_astar(
+		g, detail::make_weights(g, p), start, destination, heuristic, ws, path);
 }
 }
 
@@ -32,7 +32,8 @@
 #define GRAPH__TOPOSORT__HPP
 
 #include <tuple>
-#include <graph/type_traits.hpp>
+#include <vector>
+#include <graph/neighbors.hpp>
 #include <graph/edge.hpp>
 
 namespace graph
@@ -41,68 +42,63 @@ namespace graph
 /// to the vertex list in topological order. The graph must
 /// be free of cycles to determine a topological order.
 ///
-/// Complexity: O(V + E)
+/// Kahn's algorithm: the number of incoming edges of all vertices are
+/// computed once, vertices are processed in the order they get free
+/// of (unprocessed) incoming edges. The graph is not modified or copied.
+///
+/// Complexity: O(n + m) for graphs with cheap access to outgoing vertices,
+///   O(n^2) for matrix like graphs.
 ///
 /// \tparam Graph The graph type to visit.
 ///   Must provide the following features:
-///   - copy constructible
 ///   - type 'size_type'
 ///   - function `size_type size() const` which returns the number of nodes in the graph
-///   - function `bool at(edge) const` which returns the status of the specified edge.
-///   - function `void remove(edge)` which removes an edge from the graph
-///   - function `size_type count_incoming(vertex) const` which returns the number of incoming
-///     edges for a node
-///   - function `size_type count_edges() const` which returns the number of edges within the
-///   graph
+///   - at least one of the following:
+///     - function `void for_each_outgoing(vertex, Function) const`
+///     - function `outgoing(vertex) const` which returns the outgoing vertices
+///     - function `integral_type at(edge) const` which returns the status of the specified
+///       edge.
 ///
-/// \param[in] g The adjacency matrix.
+/// \param[in] g The graph.
 /// \return A tuple containing the list and a status which is:
 ///   - \c true : sorting successful
 ///   - \c false : graph contains cycles
 ///
-template <class Graph, typename = typename std::enable_if<detail::has_t_size_type<Graph>::value
-							   && detail::has_f_remove<Graph>::value
-							   && detail::has_f_integral_type_at<Graph>::value
-							   && detail::has_f_count_incoming<Graph>::value
-							   && detail::has_f_count_edges<Graph>::value,
-						   void>::type>
+template <class Graph,
+	typename = typename std::enable_if<detail::is_traversable<Graph>::value, void>::type>
 std::tuple<vertex_list, bool> topological_sort(const Graph & g)
 {
-	// copy of matrix to work on (remove edges)
-	Graph tm(g);
+	const vertex n = g.size();
 
-	// all nodes with no incoming edges
-	vertex_list Q;
-	for (vertex i = 0; i < g.size(); ++i)
-		if (tm.count_incoming(i) == 0)
-			Q.push_back(i);
+	// number of incoming edges per node
+	std::vector<std::size_t> in_degree(n, 0);
+	for (vertex i = 0; i < n; ++i)
+		detail::for_each_outgoing(g, i, [&in_degree](vertex to) { ++in_degree[to]; });
 
+	// the result serves as queue as well: nodes at and after `head` are not
+	// processed yet. every node gets into the queue at most once, the queue
+	// never needs more than n entries.
 	vertex_list v;
+	v.reserve(n);
 
-	// sort
-	while (Q.size() > 0) {
-		// remove node from Q
-		vertex node = Q.front();
-		Q.erase(Q.begin());
-
-		// node is member of the result vector
-		v.push_back(node);
+	// all nodes with no incoming edges
+	for (vertex i = 0; i < n; ++i)
+		if (in_degree[i] == 0)
+			v.push_back(i);
 
-		for (vertex i = 0; i < tm.size(); ++i) {
-			if (i == node)
-				continue; // not to self
-			if (tm.at({node, i})) {
-				tm.remove({node, i}); // remove edge from graph
+	// sort
+	for (std::size_t head = 0; head < v.size(); ++head) {
+		const vertex node = v[head];
 
-				// has i other incoming edges?
-				if (tm.count_incoming(i) == 0)
-					Q.push_back(i);
-			}
-		}
+		// remove edges of node, nodes without other incoming edges are next
+		detail::for_each_outgoing(g, node, [&in_degree, &v](vertex i) {
+			if (--in_degree[i] == 0)
+				v.push_back(i);
+		});
 	}
 
 	// cycle / remaining edges?
-	if (tm.count_edges() > 0)
+	if (v.size() < n)
 		return std::make_tuple(vertex_list{}, false);
 
 	return std::make_tuple(v, true);
@@ -34,6 +34,7 @@
 // This file and its content is needed as long as concepts are not
 // part of the language.
 
+#include <iterator>
 #include <type_traits>
 #include <graph/edge.hpp>
 
@@ -124,19 +125,14 @@ public:
 template <class T> class has_f_integral_type_at
 {
 private:
-	template <typename U>
+	template <typename U,
+		typename R = decltype(std::declval<const U>().at(std::declval<edge>()))>
 	static auto test(int)
-		-> decltype(std::declval<const U>().at(std::declval<edge>()), std::true_type{});
+		-> std::integral_constant<bool, std::is_integral<typename std::decay<R>::type>::value>;
 	template <typename> static std::false_type test(...);
 
-	// Return type of function `at(edge) const`
-	using Result = decltype(std::declval<const T>().at(std::declval<edge>()));
-
 public:
-	enum {
-		value = std::is_same<decltype(test<T>(0)), std::true_type>::value
-			&& std::is_integral<Result>::value
-	};
+	enum { value = decltype(test<T>(0))::value };
 };
 
 /// Checks for member function `vertex_list vertices() const`
@@ -179,10 +175,87 @@ public:
 	enum { value = std::is_same<decltype(test<T>(0)), std::true_type>::value };
 };
 
+/// Checks for member function `vertex_list incoming(vertex) const`
+template <class T> class has_f_incoming
+{
+private:
+	template <typename U>
+	static auto test(int)
+		-> decltype(std::declval<const U>().incoming(std::declval<vertex>()) == vertex_list{},
+			std::true_type{});
+	template <typename> static std::false_type test(...);
+
+public:
+	enum { value = std::is_same<decltype(test<T>(0)), std::true_type>::value };
+};
+
+/// Checks for member function `outgoing(vertex) const` which provides access
+/// to the outgoing vertices without creating a new list, i.e. which returns
+/// a reference or a view (like `vertex_range`) to data owned by the graph.
+template <class T> class has_f_outgoing_view
+{
+private:
+	template <typename U, typename R = decltype(std::declval<const U>().outgoing(vertex{}))>
+	static auto test(int) -> std::integral_constant<bool,
+		std::is_lvalue_reference<R>::value
+			|| !std::is_same<typename std::decay<R>::type, vertex_list>::value>;
+	template <typename> static std::false_type test(...);
+
+public:
+	enum { value = has_f_outgoing<T>::value && decltype(test<T>(0))::value };
+};
+
+/// Function object which accepts a vertex, used to check for member functions
+/// which take a callback.
+struct vertex_function {
+	void operator()(vertex) const {}
+};
+
+/// Checks for member function `void for_each_outgoing(vertex, Function) const`
+template <class T> class has_f_for_each_outgoing
+{
+private:
+	template <typename U>
+	static auto test(int)
+		-> decltype(std::declval<const U>().for_each_outgoing(vertex{}, vertex_function{}),
+			std::true_type{});
+	template <typename> static std::false_type test(...);
+
+public:
+	enum { value = std::is_same<decltype(test<T>(0)), std::true_type>::value };
+};
+
+/// Checks for member function `vertex next_outgoing(vertex, std::size_t &) const`
+template <class T> class has_f_next_outgoing
+{
+private:
+	template <typename U>
+	static auto test(int) -> decltype(std::declval<const U>().next_outgoing(
+										  vertex{}, std::declval<std::size_t &>()),
+		std::true_type{});
+	template <typename> static std::false_type test(...);
+
+public:
+	enum { value = std::is_same<decltype(test<T>(0)), std::true_type>::value };
+};
+
+/// Checks for member function `weights(vertex) const` which provides the values
+/// of the outgoing edges of a vertex, in the same order as `outgoing(vertex)`.
+template <class T> class has_f_weights
+{
+private:
+	template <typename U>
+	static auto test(int) -> decltype(
+		*std::begin(std::declval<const U>().weights(vertex{})) == typename U::value_type{},
+		std::true_type{});
+	template <typename> static std::false_type test(...);
+
+public:
+	enum { value = has_f_outgoing_view<T>::value && decltype(test<T>(0))::value };
+};
+
 /// Checks for member function `const_iterator end() const`
-template <class T,
-	typename = typename std::enable_if<has_t_const_iterator<T>::value, void>::type>
-class has_f_end
+template <class T> class has_f_end
 {
 private:
 	template <typename U>
@@ -195,9 +268,7 @@ public:
 };
 
 /// Checks for member function `const_iterator find(edge) const`
-template <class T,
-	typename = typename std::enable_if<has_t_const_iterator<T>::value, void>::type>
-class has_f_find
+template <class T> class has_f_find
 {
 private:
 	template <typename U>
@@ -210,6 +281,22 @@ public:
 	enum { value = std::is_same<decltype(test<T>(0)), std::true_type>::value };
 };
 
+/// Checks for member functions `size_type offset(vertex) const` and
+/// `mapped_type operator[](size_type) const`, i.e. access to values by edge id.
+template <class T> class has_f_offset
+{
+private:
+	template <typename U>
+	static auto test(int)
+		-> decltype(std::declval<const U>()[std::declval<const U>().offset(vertex{})]
+				== typename U::mapped_type{},
+			std::true_type{});
+	template <typename> static std::false_type test(...);
+
+public:
+	enum { value = std::is_same<decltype(test<T>(0)), std::true_type>::value };
+};
+
 /// Checks for member function `void remove(edge)`
 template <class T> class has_f_remove
 {
@@ -238,6 +325,19 @@ public:
 	enum { value = std::is_same<decltype(test<T>(0)), std::true_type>::value };
 };
 
+/// Checks for member function `size_type count_outgoing(vertex) const`
+template <class T> class has_f_count_outgoing
+{
+private:
+	template <typename U>
+	static auto test(int) -> decltype(
+		std::declval<const U>().count_outgoing(std::declval<vertex>()), std::true_type{});
+	template <typename> static std::false_type test(...);
+
+public:
+	enum { value = std::is_same<decltype(test<T>(0)), std::true_type>::value };
+};
+
 /// Checks for member function `size_type count_edges() const`
 template <class T,
 	typename = typename std::enable_if<detail::has_t_size_type<T>::value, void>::type>
@@ -31,6 +31,7 @@
 #ifndef GRAPH__VERTEX__HPP
 #define GRAPH__VERTEX__HPP
 
+#include <algorithm>
 #include <vector>
 #include <limits>
 
@@ -47,6 +48,52 @@ using vertex_list = std::vector<vertex>;
 
 /// Internally used to keep track of visited vertices.
 using visited_vertex_list = std::vector<bool>;
+
+/// Read only view to a consecutive sequence of vertices, owned by
+/// someone else (e.g. a graph).
+///
+/// It is used by graph representations which are able to provide
+/// lists of vertices without copying them. The view is only valid
+/// as long as the owner of the data is not modified or destroyed.
+class vertex_range
+{
+public:
+	using size_type = std::size_t;
+	using const_iterator = const vertex *;
+
+	constexpr vertex_range() noexcept = default;
+
+	constexpr vertex_range(const_iterator first, const_iterator last) noexcept
+		: first(first)
+		, last(last)
+	{
+	}
+
+	const_iterator begin() const noexcept { return first; }
+	const_iterator end() const noexcept { return last; }
+	size_type size() const noexcept { return static_cast<size_type>(last - first); }
+	bool empty() const noexcept { return first == last; }
+	vertex operator[](size_type i) const noexcept { return first[i]; }
+
+	/// Comparison operator for equality, element wise.
+	friend bool operator==(const vertex_range & a, const vertex_list & b)
+	{
+		return (a.size() == b.size()) && std::equal(a.begin(), a.end(), b.begin());
+	}
+
+	/// \see operator==(const vertex_range &, const vertex_list &)
+	friend bool operator==(const vertex_list & a, const vertex_range & b) { return b == a; }
+
+	/// \see operator==(const vertex_range &, const vertex_list &)
+	friend bool operator!=(const vertex_range & a, const vertex_list & b) { return !(a == b); }
+
+	/// \see operator==(const vertex_range &, const vertex_list &)
+	friend bool operator!=(const vertex_list & a, const vertex_range & b) { return !(b == a); }
+
+private:
+	const_iterator first = nullptr;
+	const_iterator last = nullptr;
+};
 }
 
 #endif
@@ -0,0 +1,79 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef GRAPH__VISIT__HPP
+#define GRAPH__VISIT__HPP
+
+#include <type_traits>
+#include <utility>
+
+namespace graph
+{
+/// Control value a visitor of a search may return, to steer the search.
+///
+/// Visitors returning `void` (or anything else) let the search continue,
+/// as if they returned `proceed`.
+enum class visit_result {
+	proceed, ///< Continue the search.
+	skip, ///< Do not search the outgoing vertices of the visited vertex.
+	stop ///< End the search immediately.
+};
+
+/// \cond DEV
+namespace detail
+{
+template <class Visitor, class... Args>
+visit_result visit(std::true_type, Visitor & visitor, Args &&... args)
+{
+	return visitor(std::forward<Args>(args)...);
+}
+
+template <class Visitor, class... Args>
+visit_result visit(std::false_type, Visitor & visitor, Args &&... args)
+{
+	visitor(std::forward<Args>(args)...);
+	return visit_result::proceed;
+}
+
+/// Calls the visitor and returns its control value, or `visit_result::proceed`
+/// if the visitor does not return a `visit_result`. Decided at compile time.
+template <class Visitor, class... Args>
+visit_result visit(Visitor & visitor, Args &&... args)
+{
+	using result_type = decltype(visitor(std::forward<Args>(args)...));
+	return visit(std::is_same<typename std::decay<result_type>::type, visit_result>{},
+		visitor, std::forward<Args>(args)...);
+}
+}
+/// \endcond
+}
+
+#endif
@@ -0,0 +1,154 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef GRAPH__VISITED_SET__HPP
+#define GRAPH__VISITED_SET__HPP
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+#include <graph/vertex.hpp>
+#include <utils/bits.hpp>
+
+namespace graph
+{
+/// Set of vertices, e.g. the ones already visited by a search, stored as
+/// bits packed into words.
+///
+/// Unlike `visited_vertex_list` (`std::vector<bool>`), the access is plain
+/// bit manipulation on words, and the set can be cleared and reused for
+/// repeated searches without allocation.
+class visited_set
+{
+public:
+	using size_type = std::size_t;
+
+	/// \{
+	visited_set() = default;
+
+	/// Creates an empty set for vertices `0..n-1`.
+	explicit visited_set(size_type n)
+		: n(n)
+		, bits(utils::words_for_bits(n), 0)
+	{
+	}
+	/// \}
+
+	/// Returns the number of vertices the set is able to hold.
+	size_type size() const noexcept { return n; }
+
+	/// Returns true if the vertex is in the set.
+	bool test(vertex v) const noexcept
+	{
+		return (bits[v / utils::word_bits] >> (v % utils::word_bits)) & 1u;
+	}
+
+	/// Adds the vertex to the set.
+	void set(vertex v) noexcept
+	{
+		bits[v / utils::word_bits] |= utils::word{1} << (v % utils::word_bits);
+	}
+
+	/// Adds the vertex to the set and returns true if it was in the set before.
+	bool test_and_set(vertex v) noexcept
+	{
+		auto & w = bits[v / utils::word_bits];
+		const utils::word mask = utils::word{1} << (v % utils::word_bits);
+		const bool was_set = w & mask;
+		w |= mask;
+		return was_set;
+	}
+
+	/// Removes all vertices from the set.
+	///
+	/// Complexity: O(n / 64), no allocation
+	void reset() noexcept { std::fill(std::begin(bits), std::end(bits), utils::word{0}); }
+
+	/// Removes all vertices from the set and changes its size. Memory is
+	/// only allocated if the set has to grow beyond its capacity.
+	void reset(size_type size)
+	{
+		n = size;
+		bits.assign(utils::words_for_bits(n), 0);
+	}
+
+	/// Returns the number of vertices in the set.
+	///
+	/// Complexity: O(n / 64)
+	size_type count() const noexcept
+	{
+		size_type c = 0;
+		for (auto const w : bits)
+			c += utils::popcount(w);
+		return c;
+	}
+
+	/// Adds all vertices of the other set, which must have the same size.
+	///
+	/// Complexity: O(n / 64)
+	visited_set & operator|=(const visited_set & other) noexcept
+	{
+		assert(n == other.n);
+		for (size_type i = 0; i < bits.size(); ++i)
+			bits[i] |= other.bits[i];
+		return *this;
+	}
+
+	/// Removes all vertices not in the other set, which must have the same size.
+	///
+	/// Complexity: O(n / 64)
+	visited_set & operator&=(const visited_set & other) noexcept
+	{
+		assert(n == other.n);
+		for (size_type i = 0; i < bits.size(); ++i)
+			bits[i] &= other.bits[i];
+		return *this;
+	}
+
+	/// Comparison operator for equality.
+	friend bool operator==(const visited_set & a, const visited_set & b) noexcept
+	{
+		return (a.n == b.n) && (a.bits == b.bits);
+	}
+
+	/// Comparison operator for inequality.
+	friend bool operator!=(const visited_set & a, const visited_set & b) noexcept
+	{
+		return !(a == b);
+	}
+
+private:
+	size_type n = 0;
+	std::vector<utils::word> bits;
+};
+}
+
+#endif
@@ -0,0 +1,226 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef GRAPH__WEIGHT__HPP
+#define GRAPH__WEIGHT__HPP
+
+#include <iterator>
+#include <type_traits>
+#include <graph/type_traits.hpp>
+#include <graph/neighbors.hpp>
+#include <graph/edge.hpp>
+
+namespace graph
+{
+/// \cond DEV
+namespace detail
+{
+/// Provides the weights of the outgoing edges of a vertex by calling an
+/// accessor `Value(edge)` for each edge, e.g. a lookup in a property map.
+template <class Value, class Graph, class Accessor> class accessor_weights
+{
+private:
+	const Graph & g;
+	Accessor access;
+
+public:
+	using value_type = Value;
+
+	accessor_weights(const Graph & g, Accessor access)
+		: g(g)
+		, access(access)
+	{
+	}
+
+	/// Calls `f(vertex, value_type)` for each outgoing vertex of `u`.
+	///
+	/// Complexity: O(d) times the complexity of the accessor
+	template <class Function> void for_each_outgoing(vertex u, Function && f) const
+	{
+		detail::for_each_outgoing(g, u, [&](vertex v) { f(v, access(edge{u, v})); });
+	}
+
+	/// Calls `f(vertex, value_type)` for each incoming vertex of `v`.
+	/// The graph must provide `incoming(vertex)`.
+	///
+	/// Complexity: complexity of `incoming(vertex)` plus d times the complexity
+	///   of the accessor
+	template <class Function> void for_each_incoming(vertex v, Function && f) const
+	{
+		for (auto const u : g.incoming(v))
+			f(u, access(edge{u, v}));
+	}
+};
+
+/// Provides the weights of the outgoing edges of a vertex from the graph
+/// itself, which stores them next to the outgoing vertices (see `has_f_weights`).
+template <class Graph> class inline_weights
+{
+private:
+	const Graph & g;
+
+public:
+	using value_type = typename Graph::value_type;
+
+	inline_weights(const Graph & g)
+		: g(g)
+	{
+	}
+
+	/// Calls `f(vertex, value_type)` for each outgoing vertex of `u`.
+	///
+	/// Complexity: O(d)
+	template <class Function> void for_each_outgoing(vertex u, Function && f) const
+	{
+		auto const & targets = g.outgoing(u);
+		auto const & values = g.weights(u);
+		auto w = std::begin(values);
+		for (auto v = std::begin(targets); v != std::end(targets); ++v, ++w)
+			f(*v, *w);
+	}
+
+	/// Calls `f(vertex, value_type)` for each incoming vertex of `v`.
+	/// The graph must provide `incoming(vertex)`, the values are queried
+	/// by `at(edge)`.
+	template <class Function> void for_each_incoming(vertex v, Function && f) const
+	{
+		for (auto const u : g.incoming(v))
+			f(u, g.at(edge{u, v}));
+	}
+};
+
+/// Provides the weights of the outgoing edges of a vertex from a property
+/// map which stores them by edge id (see `has_f_offset`, `edge_property_map`).
+template <class Graph, class PropertyMap> class indexed_weights
+{
+private:
+	const Graph & g;
+	const PropertyMap & p;
+
+public:
+	using value_type = typename PropertyMap::mapped_type;
+
+	indexed_weights(const Graph & g, const PropertyMap & p)
+		: g(g)
+		, p(p)
+	{
+	}
+
+	/// Calls `f(vertex, value_type)` for each outgoing vertex of `u`.
+	///
+	/// Complexity: O(d) for graphs with cheap access to outgoing vertices
+	template <class Function> void for_each_outgoing(vertex u, Function && f) const
+	{
+		auto id = p.offset(u);
+		detail::for_each_outgoing(g, u, [&](vertex v) { f(v, p[id++]); });
+	}
+
+	/// Calls `f(vertex, value_type)` for each incoming vertex of `v`.
+	/// The graph must provide `incoming(vertex)`, the ids of the edges
+	/// are searched among the outgoing edges of the incoming vertices.
+	template <class Function> void for_each_incoming(vertex v, Function && f) const
+	{
+		for (auto const u : g.incoming(v))
+			f(u, p[p.id(g, edge{u, v})]);
+	}
+};
+
+/// Checks if the type is a property map which provides values for edges,
+/// either by lookup (`find(edge)`, `end()`, e.g. `std::map<edge, T>`) or
+/// by edge id (`offset(vertex)`, e.g. `edge_property_map`).
+template <class PropertyMap> struct is_edge_property_map {
+	enum {
+		value = has_t_mapped_type<PropertyMap>::value
+			&& ((has_t_const_iterator<PropertyMap>::value && has_f_find<PropertyMap>::value
+					&& has_f_end<PropertyMap>::value)
+				|| has_f_offset<PropertyMap>::value)
+	};
+};
+
+/// Returns the weights provided by the specified accessor.
+template <class Value, class Graph, class Accessor>
+accessor_weights<Value, Graph, Accessor> make_weights(const Graph & g, Accessor access)
+{
+	return {g, access};
+}
+
+template <class Graph> inline_weights<Graph> graph_weights(const Graph & g, std::true_type)
+{
+	return {g};
+}
+
+template <class Graph> auto graph_weights(const Graph & g, std::false_type)
+{
+	using Value = typename Graph::value_type;
+	return make_weights<Value>(g, [&g](edge e) -> Value { return g.at(e); });
+}
+
+/// Returns the weights of the edges as they are stored in the graph, i.e.
+/// the values returned by `at(edge)`. Graphs which provide the values of
+/// outgoing edges by `weights(vertex)` are read directly.
+template <class Graph> auto make_weights(const Graph & g)
+{
+	return graph_weights(g, std::integral_constant<bool, has_f_weights<Graph>::value>{});
+}
+
+template <class Graph, class PropertyMap>
+indexed_weights<Graph, PropertyMap> property_weights(
+	const Graph & g, const PropertyMap & p, std::true_type)
+{
+	return {g, p};
+}
+
+template <class Graph, class PropertyMap>
+auto property_weights(const Graph & g, const PropertyMap & p, std::false_type)
+{
+	using Value = typename PropertyMap::mapped_type;
+	return make_weights<Value>(g, [&p](edge e) -> Value {
+		auto const i = p.find(e);
+		if (i != p.end())
+			return i->second;
+		return {};
+	});
+}
+
+/// Returns the weights of the edges stored in the specified property map.
+/// Edges not contained in the map have a default constructed value.
+/// Property maps providing access by edge id are read without lookup.
+template <class Graph, class PropertyMap>
+auto make_weights(const Graph & g, const PropertyMap & p)
+{
+	return property_weights(
+		g, p, std::integral_constant<bool, has_f_offset<PropertyMap>::value>{});
+}
+}
+/// \endcond
+}
+
+#endif
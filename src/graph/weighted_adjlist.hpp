@@ -0,0 +1,313 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef GRAPH__WEIGHTED_ADJLIST__HPP
+#define GRAPH__WEIGHTED_ADJLIST__HPP
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include <cassert>
+#include <graph/edge.hpp>
+
+namespace graph
+{
+/// Represents a graph as adjacency list with a value (weight) for each edge.
+///
+/// The weights are stored next to the outgoing vertices, in a separate list
+/// per vertex with the same order (struct of arrays). Algorithms which need
+/// the weights of all outgoing edges of a vertex read them sequentially
+/// through weights(), without a lookup per edge.
+///
+/// Once constructed, the size is constant. It is not possible to
+/// grow or shrink.
+///
+/// Hits to complexity of member functions is in the form: `O(n + m)`
+/// with `n` as number of vertices and `m` as number of edges.
+///
+/// \tparam T The type of the edge values
+///
+template <class T> class weighted_adjlist
+{
+public:
+	using size_type = vertex;
+	using value_type = T;
+	using weight_list = std::vector<value_type>;
+
+private:
+	struct neighbors {
+		vertex_list targets;
+		weight_list weights;
+	};
+
+	size_type n; // number of nodes
+	std::vector<neighbors> m;
+
+	/// Returns the index of the vertex within the list of targets, or the
+	/// size of the list if not found.
+	static std::size_t find(const neighbors & l, vertex v)
+	{
+		return std::find(std::begin(l.targets), std::end(l.targets), v)
+			- std::begin(l.targets);
+	}
+
+	static void insert(neighbors & l, vertex v, value_type value)
+	{
+		auto const i = find(l, v);
+		if (i < l.targets.size()) {
+			l.weights[i] = value;
+			return;
+		}
+		l.targets.push_back(v);
+		l.weights.push_back(value);
+	}
+
+	static void remove(neighbors & l, vertex v)
+	{
+		auto const i = find(l, v);
+		if (i >= l.targets.size())
+			return;
+		l.targets.erase(std::begin(l.targets) + i);
+		l.weights.erase(std::begin(l.weights) + i);
+	}
+
+public:
+	/// \{
+	/// Constructor to set the size of the graph and initialize it
+	/// with no edges.
+	///
+	/// \param[in] n Size of the graph.
+	weighted_adjlist(size_type n)
+		: n(n)
+		, m(n)
+	{
+		assert(n > 0);
+	}
+
+	/// Constructor which takes the number of vertices and an initializer list
+	/// of edges to initialize the adjacency list. All edges get the value `1`.
+	///
+	/// \param[in] n Number of vertices, i.e. the size of the graph.
+	/// \param[in] edges Edges to initialize the graph with.
+	weighted_adjlist(size_type n, std::initializer_list<edge> edges)
+		: weighted_adjlist(n)
+	{
+		for (auto const & e : edges)
+			add(e);
+	}
+
+	weighted_adjlist(const weighted_adjlist &) = default;
+	weighted_adjlist(weighted_adjlist &&) = default;
+	/// \}
+
+	/// \{
+	weighted_adjlist & operator=(const weighted_adjlist &) = default;
+	weighted_adjlist & operator=(weighted_adjlist &&) = default;
+	/// \}
+
+	/// \{
+	/// Adds an edge to the graph. If the edge already exists, its
+	/// value is replaced.
+	///
+	/// Complexity: O(m)
+	///
+	/// \param[in] e The edge to add
+	/// \param[in] type Type of edge to add
+	/// \param[in] value The value (weight) of the edge, default is `1`
+	/// \return true on success, false otherwise
+	///
+	/// \note This function performs boundary check.
+	bool add(edge e, edge::type type = edge::type::uni, value_type value = value_type{1})
+	{
+		if ((e.from >= n) || (e.to >= n))
+			return false;
+		insert(m[e.from], e.to, value);
+		if (type == edge::type::bi)
+			insert(m[e.to], e.from, value);
+		return true;
+	}
+
+	/// \see add()
+	bool add(vertex from, vertex to, edge::type type = edge::type::uni,
+		value_type value = value_type{1})
+	{
+		return add({from, to}, type, value);
+	}
+	/// \}
+
+	/// \{
+	/// Removes an edge from the graph.
+	///
+	/// Complexity: O(m)
+	///
+	/// \param[in] e Edge to remove
+	/// \param[in] type Type of edge to add
+	/// \return true on success, false otherwise
+	///
+	/// \note This function performs boundary check.
+	bool remove(edge e, edge::type type = edge::type::uni)
+	{
+		if ((e.from >= n) || (e.to >= n))
+			return false;
+		remove(m[e.from], e.to);
+		if (type == edge::type::bi)
+			remove(m[e.to], e.from);
+		return true;
+	}
+
+	/// \see remove()
+	bool remove(vertex from, vertex to, edge::type type = edge::type::uni)
+	{
+		return remove({from, to}, type);
+	}
+	/// \}
+
+	/// \{
+	/// Accessor for edges. This method provides read only access
+	/// to the graph and is not boundary checked.
+	///
+	/// Complexity: O(m)
+	///
+	/// \return The value of the edge, or a default constructed value
+	///   if the edge does not exist.
+	value_type at(edge e) const
+	{
+		auto const & l = m[e.from];
+		auto const i = find(l, e.to);
+		return (i < l.targets.size()) ? l.weights[i] : value_type{};
+	}
+
+	/// Convenience function. See \see at(edge) const
+	value_type at(vertex from, vertex to) const { return at({from, to}); }
+
+	/// Accessor for edges, uses index operator.
+	value_type operator[](edge e) const { return at(e); }
+	/// \}
+
+	/// \{
+	/// Returns the size of the graph (number of vertices).
+	size_type size() const noexcept { return n; }
+
+	/// Returns a list of vertices. This function is for convinience only.
+	///
+	/// Complexity: O(n)
+	vertex_list vertices() const
+	{
+		vertex_list v(size());
+		std::iota(v.begin(), v.end(), 0);
+		return v;
+	}
+
+	/// Returns the number of incoming edges to the specified vertex.
+	///
+	/// If the specified vertex is invalid the function returns 0.
+	///
+	/// Complexity: O(n + m)
+	size_type count_incoming(vertex to) const
+	{
+		if (to >= n)
+			return 0;
+		return std::count_if(std::begin(m), std::end(m),
+			[to](const neighbors & l) { return find(l, to) < l.targets.size(); });
+	}
+
+	/// Returns a list of nodes from where an edge exists.
+	///
+	/// If the specified vertex is invalid, an empty list will return.
+	///
+	/// Complexity: O(n + m)
+	vertex_list incoming(vertex to) const
+	{
+		vertex_list v;
+		if (to >= n)
+			return v;
+		for (vertex i = 0; i < n; ++i)
+			if (find(m[i], to) < m[i].targets.size())
+				v.push_back(i);
+		return v;
+	}
+
+	/// Returns the number of outgoing edges of the specified vertex.
+	///
+	/// If the specified vertex is invalid the function returns 0.
+	///
+	/// Complexity: O(1)
+	size_type count_outgoing(vertex from) const
+	{
+		if (from >= n)
+			return 0;
+		return m[from].targets.size();
+	}
+
+	/// Returns a list of nodes to where an edge exists.
+	///
+	/// This function is not boundary checked.
+	///
+	/// Complexity: O(1)
+	const vertex_list & outgoing(vertex from) const { return m[from].targets; }
+
+	/// Returns the values of the outgoing edges of the specified vertex,
+	/// in the same order as outgoing().
+	///
+	/// This function is not boundary checked.
+	///
+	/// Complexity: O(1)
+	const weight_list & weights(vertex from) const { return m[from].weights; }
+	/// \}
+
+	/// \{
+	/// Returns the total number of edges within the graph.
+	///
+	/// Complexity: O(n)
+	size_type count_edges() const noexcept
+	{
+		size_type sum = 0;
+		for (auto const & l : m)
+			sum += l.targets.size();
+		return sum;
+	}
+
+	/// Returns a list of edges defined by the graph.
+	///
+	/// Complexity: O(n + m)
+	edge_list edges() const
+	{
+		edge_list vec;
+		for (vertex from = 0; from < n; ++from)
+			for (const auto & to : m[from].targets)
+				vec.emplace_back(from, to);
+		return vec;
+	}
+	/// \}
+};
+}
+
+#endif
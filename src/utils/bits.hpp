@@ -0,0 +1,76 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef UTILS__BITS__HPP
+#define UTILS__BITS__HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cassert>
+
+namespace utils
+{
+/// Type of words used to store bits.
+using word = std::uint64_t;
+
+/// Number of bits within one word.
+enum : unsigned { word_bits = 64 };
+
+/// Returns the number of words necessary to store the specified number of bits.
+constexpr std::size_t words_for_bits(std::size_t n) noexcept
+{
+	return (n + word_bits - 1) / word_bits;
+}
+
+/// Returns the number of bits set within the specified word.
+inline unsigned popcount(word w) noexcept { return __builtin_popcountll(w); }
+
+/// Returns the position of the lowest bit set within the specified word.
+///
+/// \note The word must not be zero.
+inline unsigned count_trailing_zeros(word w) noexcept
+{
+	assert(w != 0);
+	return __builtin_ctzll(w);
+}
+
+/// Calls the specified function for the position of each bit set
+/// within the specified word, lowest bit first.
+template <class Function> void for_each_bit(word w, Function f)
+{
+	while (w) {
+		f(count_trailing_zeros(w));
+		w &= w - 1;
+	}
+}
+}
+
+#endif
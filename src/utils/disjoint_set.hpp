@@ -0,0 +1,123 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef UTILS__DISJOINT_SET__HPP
+#define UTILS__DISJOINT_SET__HPP
+
+#include <numeric>
+#include <utility>
+#include <vector>
+#include <cassert>
+
+namespace utils
+{
+/// Disjoint set (union-find) of the elements `[0, size)`.
+///
+/// Initially each element is in its own set. Uses union by rank and
+/// path halving, which makes all operations practically `O(1)` (amortized
+/// inverse Ackermann function).
+class disjoint_set
+{
+public:
+	using size_type = std::size_t;
+
+	/// \{
+	/// Construction of `n` sets, each containing one element.
+	///
+	/// Complexity: O(n)
+	explicit disjoint_set(size_type n = 0)
+		: parent(n)
+		, rank(n, 0)
+		, sets(n)
+	{
+		std::iota(std::begin(parent), std::end(parent), 0);
+	}
+
+	disjoint_set(const disjoint_set &) = default;
+	disjoint_set(disjoint_set &&) noexcept = default;
+	/// \}
+
+	/// \{
+	disjoint_set & operator=(const disjoint_set &) = default;
+	disjoint_set & operator=(disjoint_set &&) noexcept = default;
+	/// \}
+
+	/// \{
+	/// Returns the number of elements.
+	size_type size() const noexcept { return parent.size(); }
+
+	/// Returns the number of disjoint sets.
+	size_type count() const noexcept { return sets; }
+	/// \}
+
+	/// \{
+	/// Returns the representative of the set containing the specified element.
+	size_type find(size_type x)
+	{
+		assert(x < size());
+		while (parent[x] != x) {
+			parent[x] = parent[parent[x]];
+			x = parent[x];
+		}
+		return x;
+	}
+
+	/// Returns `true` if both elements are in the same set.
+	bool same(size_type a, size_type b) { return find(a) == find(b); }
+
+	/// Merges the sets containing the specified elements.
+	///
+	/// \return `true` if the sets were merged, `false` if both elements
+	///   were already in the same set.
+	bool unite(size_type a, size_type b)
+	{
+		a = find(a);
+		b = find(b);
+		if (a == b)
+			return false;
+		if (rank[a] < rank[b])
+			std::swap(a, b);
+		parent[b] = a;
+		if (rank[a] == rank[b])
+			++rank[a];
+		--sets;
+		return true;
+	}
+	/// \}
+
+private:
+	std::vector<size_type> parent;
+	std::vector<unsigned char> rank;
+	size_type sets;
+};
+}
+
+#endif
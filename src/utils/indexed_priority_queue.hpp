@@ -0,0 +1,239 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef UTILS__INDEXED_PRIORITY_QUEUE__HPP
+#define UTILS__INDEXED_PRIORITY_QUEUE__HPP
+
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <cassert>
+
+namespace utils
+{
+/// Indexed priority queue, implemented as binary heap.
+///
+/// The queue manages keys in the range `[0, capacity)`, each key associated
+/// with a priority. Every key can be in the queue at most once. The queue
+/// keeps track of the position of each key within the heap, which makes
+/// it possible to check for keys and to change their priorities
+/// efficiently.
+///
+/// The key on top of the queue is the one with the lowest priority,
+/// according to `Compare`. With the default comparison, this is the
+/// smallest value, which is the natural order for shortest path algorithms
+/// (note: this is the opposite of `std::priority_queue`).
+///
+/// \tparam Priority The type of the priorities, must be default constructible.
+/// \tparam Compare Type of the comparison functionality.
+///
+template <class Priority, class Compare = std::less<Priority>> class indexed_priority_queue
+{
+public:
+	using key_type = std::size_t;
+	using priority_type = Priority;
+	using size_type = std::size_t;
+
+	/// Position of keys which are not in the queue.
+	enum : size_type { npos = std::numeric_limits<size_type>::max() };
+
+	/// \{
+	/// Construction of an empty queue, able to hold the keys `[0, capacity)`.
+	///
+	/// Complexity: O(capacity)
+	///
+	/// \param[in] capacity Number of keys the queue is able to manage.
+	/// \param[in] cmp The comparison functor
+	explicit indexed_priority_queue(size_type capacity = 0, const Compare & cmp = Compare{})
+		: comp(cmp)
+		, pos(capacity, npos)
+		, prio(capacity)
+	{
+		heap.reserve(capacity);
+	}
+
+	indexed_priority_queue(const indexed_priority_queue &) = default;
+	indexed_priority_queue(indexed_priority_queue &&) noexcept = default;
+	/// \}
+
+	/// \{
+	indexed_priority_queue & operator=(const indexed_priority_queue &) = default;
+	indexed_priority_queue & operator=(indexed_priority_queue &&) noexcept = default;
+	/// \}
+
+	/// \{
+	size_type size() const noexcept { return heap.size(); }
+	bool empty() const noexcept { return heap.empty(); }
+	size_type capacity() const noexcept { return pos.size(); }
+
+	/// Returns `true` if the specified key is in the queue.
+	///
+	/// Complexity: O(1)
+	bool contains(key_type k) const noexcept { return (k < pos.size()) && (pos[k] != npos); }
+
+	/// Returns the priority of the specified key. The key must be in the queue.
+	///
+	/// Complexity: O(1)
+	const priority_type & priority(key_type k) const
+	{
+		assert(contains(k));
+		return prio[k];
+	}
+	/// \}
+
+	/// \{
+	/// Returns the key with the lowest priority.
+	key_type top() const
+	{
+		assert(!empty());
+		return heap.front();
+	}
+
+	/// Returns the priority of the key on top of the queue.
+	const priority_type & top_priority() const { return prio[top()]; }
+	/// \}
+
+	/// \{
+	/// Pushes a new key with the specified priority into the queue.
+	/// The key must not be in the queue already.
+	///
+	/// Complexity: O(log n)
+	void push(key_type k, const priority_type & p)
+	{
+		assert(k < capacity());
+		assert(!contains(k));
+		prio[k] = p;
+		pos[k] = heap.size();
+		heap.push_back(k);
+		sift_up(pos[k]);
+	}
+
+	/// Removes the key with the lowest priority from the queue.
+	///
+	/// Complexity: O(log n)
+	void pop()
+	{
+		assert(!empty());
+		pos[heap.front()] = npos;
+		heap.front() = heap.back();
+		heap.pop_back();
+		if (!heap.empty()) {
+			pos[heap.front()] = 0;
+			sift_down(0);
+		}
+	}
+
+	/// Removes all keys from the queue. The capacity stays the same.
+	///
+	/// Complexity: O(n)
+	void clear() noexcept
+	{
+		for (auto const k : heap)
+			pos[k] = npos;
+		heap.clear();
+	}
+	/// \}
+
+	/// \{
+	/// Lowers the priority of the specified key, which must be in the queue.
+	/// The new priority must not be greater than the current one.
+	///
+	/// Complexity: O(log n)
+	void decrease_key(key_type k, const priority_type & p)
+	{
+		assert(contains(k));
+		assert(!comp(prio[k], p));
+		prio[k] = p;
+		sift_up(pos[k]);
+	}
+
+	/// Sets the priority of the specified key, which must be in the queue.
+	/// In contrast to decrease_key(), the priority may also grow.
+	///
+	/// Complexity: O(log n)
+	void update(key_type k, const priority_type & p)
+	{
+		assert(contains(k));
+		const bool lower = comp(p, prio[k]);
+		prio[k] = p;
+		if (lower) {
+			sift_up(pos[k]);
+		} else {
+			sift_down(pos[k]);
+		}
+	}
+	/// \}
+
+private:
+	Compare comp;
+	std::vector<key_type> heap; // keys, organized as binary heap
+	std::vector<size_type> pos; // position of keys within the heap
+	std::vector<priority_type> prio; // priorities of keys
+
+	bool less(size_type i, size_type j) const { return comp(prio[heap[i]], prio[heap[j]]); }
+
+	void swap(size_type i, size_type j) noexcept
+	{
+		std::swap(heap[i], heap[j]);
+		pos[heap[i]] = i;
+		pos[heap[j]] = j;
+	}
+
+	void sift_up(size_type i)
+	{
+		while (i > 0) {
+			const size_type parent = (i - 1) / 2;
+			if (!less(i, parent))
+				break;
+			swap(i, parent);
+			i = parent;
+		}
+	}
+
+	void sift_down(size_type i)
+	{
+		for (;;) {
+			const size_type l = 2 * i + 1;
+			if (l >= heap.size())
+				break;
+			const size_type r = l + 1;
+			const size_type c = ((r < heap.size()) && less(r, l)) ? r : l;
+			if (!less(c, i))
+				break;
+			swap(i, c);
+			i = c;
+		}
+	}
+};
+}
+
+#endif
@@ -159,13 +159,16 @@ public:
 	/// \{
 	/// Re-creates the heap.
 	///
-	/// Complexity: O(log n) (same as std::make_heap)
+	/// Complexity: O(n) (same as std::make_heap)
+	///
+	/// \see indexed_priority_queue for changing priorities of single elements
+	///   in O(log n)
 	void update() { std::make_heap(std::begin(data), std::end(data), comp); }
 
 	/// Update of a specific value within the container. The heap will
 	/// be created newly.
 	///
-	/// Complexity: O(log n) (same as std::make_heap)
+	/// Complexity: O(n) (same as std::make_heap)
 	///
 	/// \param[in] i Index at which position the element should be updated.
 	/// \param[in] t The data to write to the specified index. The old
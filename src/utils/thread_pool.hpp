@@ -0,0 +1,155 @@
+// License: BSD
+//
+// Copyright (c) 2015, Mario Konrad
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. All advertising materials mentioning features or use of this software
+//    must display the following acknowledgement:
+//    This product includes software developed by Mario Konrad.
+// 4. Neither the content of this file nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef UTILS__THREAD_POOL__HPP
+#define UTILS__THREAD_POOL__HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace utils
+{
+/// Fixed number of threads executing a function together (fork-join).
+///
+/// run() executes the function once on each thread of the pool, with the
+/// index of the thread as argument, and returns when all are finished.
+/// The calling thread takes part as thread `0`, a pool of size `n`
+/// therefore starts `n - 1` threads. The return of run() is a barrier:
+/// everything the threads did is visible to the caller and to the next
+/// call of run().
+///
+/// The threads are started once, at construction, and wait for work
+/// in between calls of run().
+class thread_pool
+{
+public:
+	using size_type = std::size_t;
+
+private:
+	std::vector<std::thread> threads;
+
+	std::mutex mtx;
+	std::condition_variable cv_start;
+	std::condition_variable cv_done;
+	const std::function<void(size_type)> * job = nullptr;
+	size_type generation = 0; // number of jobs started
+	size_type pending = 0; // number of threads still working on the current job
+	bool stop = false;
+
+	void work(size_type index)
+	{
+		size_type seen = 0;
+		for (;;) {
+			const std::function<void(size_type)> * f = nullptr;
+			{
+				std::unique_lock<std::mutex> lock(mtx);
+				cv_start.wait(lock, [&] { return stop || (generation != seen); });
+				if (stop)
+					return;
+				seen = generation;
+				f = job;
+			}
+
+			(*f)(index);
+
+			{
+				std::lock_guard<std::mutex> lock(mtx);
+				if (--pending == 0)
+					cv_done.notify_one();
+			}
+		}
+	}
+
+public:
+	/// \{
+	/// Creates a pool of the specified number of threads, including the
+	/// calling thread. The default is the number of hardware threads.
+	explicit thread_pool(size_type n = std::max(1u, std::thread::hardware_concurrency()))
+	{
+		for (size_type i = 1; i < n; ++i)
+			threads.emplace_back(&thread_pool::work, this, i);
+	}
+
+	thread_pool(const thread_pool &) = delete;
+	thread_pool(thread_pool &&) = delete;
+
+	~thread_pool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			stop = true;
+		}
+		cv_start.notify_all();
+		for (auto & t : threads)
+			t.join();
+	}
+	/// \}
+
+	/// \{
+	thread_pool & operator=(const thread_pool &) = delete;
+	thread_pool & operator=(thread_pool &&) = delete;
+	/// \}
+
+	/// Returns the number of threads, including the calling thread.
+	size_type size() const noexcept { return threads.size() + 1; }
+
+	/// Executes `f(index)` on all threads of the pool, `index` in `[0, size())`,
+	/// and waits until all are finished. The function must not throw.
+	template <class Function> void run(Function && f)
+	{
+		if (threads.empty()) {
+			f(size_type{0});
+			return;
+		}
+
+		const std::function<void(size_type)> func = std::ref(f);
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			job = &func;
+			pending = threads.size();
+			++generation;
+		}
+		cv_start.notify_all();
+
+		f(size_type{0});
+
+		std::unique_lock<std::mutex> lock(mtx);
+		cv_done.wait(lock, [this] { return pending == 0; });
+		job = nullptr;
+	}
+};
+}
+
+#endif
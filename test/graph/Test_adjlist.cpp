@@ -90,4 +90,84 @@ TEST(Test_adjlist, vertices)
 
 	EXPECT_EQ((graph::vertex_list{0, 1, 2, 3}), v);
 }
+
+TEST(Test_adjlist, construction_edge_list)
+{
+	const graph::edge_list edges{{0, 2}, {0, 1}, {0, 2}, {1, 3}, {4, 0}};
+	const graph::adjlist g{4, edges};
+	EXPECT_EQ(3u, g.count_edges());
+	EXPECT_EQ((graph::vertex_list{1, 2}), g.outgoing(0));
+}
+
+TEST(Test_adjlist, add_edge_list)
+{
+	graph::adjlist g{4, {{0, 3}, {0, 1}}};
+
+	EXPECT_TRUE(g.add(graph::edge_list{{0, 2}, {0, 1}, {2, 3}, {0, 0}}));
+	EXPECT_EQ(5u, g.count_edges());
+	EXPECT_EQ((graph::vertex_list{3, 1, 0, 2}), g.outgoing(0));
+	EXPECT_EQ((graph::vertex_list{3}), g.outgoing(2));
+}
+
+TEST(Test_adjlist, add_edge_list_out_of_range)
+{
+	graph::adjlist g{4};
+
+	EXPECT_FALSE(g.add(graph::edge_list{{0, 2}, {0, 4}, {4, 1}}));
+	EXPECT_EQ(1u, g.count_edges());
+}
+
+TEST(Test_adjlist, add_edge_list_bidirectional)
+{
+	graph::adjlist g{3};
+
+	EXPECT_TRUE(g.add(graph::edge_list{{0, 1}, {1, 0}, {1, 2}}, graph::edge::type::bi));
+	EXPECT_EQ(4u, g.count_edges());
+	EXPECT_EQ((graph::vertex_list{0, 2}), g.outgoing(1));
+}
+
+TEST(Test_adjlist, sorted_add)
+{
+	graph::sorted_adjlist g{5, {{0, 3}, {0, 1}, {0, 4}, {0, 1}, {0, 2}}};
+
+	EXPECT_EQ(4u, g.count_edges());
+	EXPECT_EQ((graph::vertex_list{1, 2, 3, 4}), g.outgoing(0));
+	EXPECT_TRUE(g.at(0, 3));
+	EXPECT_FALSE(g.at(0, 0));
+}
+
+TEST(Test_adjlist, sorted_remove)
+{
+	graph::sorted_adjlist g{5, {{0, 3}, {0, 1}, {0, 4}, {0, 2}}};
+
+	g.remove(0, 3);
+	g.remove(0, 0);
+
+	EXPECT_EQ((graph::vertex_list{1, 2, 4}), g.outgoing(0));
+}
+
+TEST(Test_adjlist, sorted_add_edge_list)
+{
+	graph::sorted_adjlist g{5, {{0, 3}, {0, 1}}};
+
+	EXPECT_TRUE(g.add(graph::edge_list{{0, 4}, {0, 2}, {0, 3}, {0, 0}, {1, 0}}));
+	EXPECT_EQ(6u, g.count_edges());
+	EXPECT_EQ((graph::vertex_list{0, 1, 2, 3, 4}), g.outgoing(0));
+	EXPECT_EQ(2u, g.count_incoming(0));
+	EXPECT_EQ((graph::vertex_list{0}), g.incoming(3));
+}
+
+TEST(Test_adjlist, sorted_hub_vertex)
+{
+	const graph::vertex n = 100000;
+	graph::edge_list edges;
+	for (graph::vertex i = n - 1; i > 0; --i)
+		edges.emplace_back(0, i);
+	const graph::sorted_adjlist g{n, edges};
+
+	EXPECT_EQ(n - 1, g.count_outgoing(0));
+	EXPECT_TRUE(g.at(0, n / 2));
+	EXPECT_EQ(1u, g.outgoing(0).front());
+	EXPECT_EQ(n - 1, g.outgoing(0).back());
+}
 }
@@ -90,4 +90,34 @@ TEST(Test_adjmatrix, vertices)
 
 	EXPECT_EQ((graph::vertex_list{0, 1, 2, 3}), v);
 }
+
+template <class Layout> void test_layout()
+{
+	graph::basic_adjmatrix<Layout> m{70, {{0, 1}, {0, 69}, {1, 0}, {68, 2}, {69, 69}}};
+	m.add(3, 4, graph::edge::type::uni, 5);
+
+	EXPECT_EQ(6u, m.count_edges());
+	EXPECT_EQ(1, m.at(0, 1));
+	EXPECT_EQ(1, m.at(1, 0));
+	EXPECT_EQ(5, m.at(3, 4));
+	EXPECT_EQ(0, m.at(4, 3));
+	EXPECT_EQ((graph::vertex_list{1, 69}), m.outgoing(0));
+	EXPECT_EQ((graph::vertex_list{0, 69}), m.incoming(69));
+	EXPECT_EQ(2u, m.count_outgoing(0));
+	EXPECT_EQ(1u, m.count_incoming(2));
+	EXPECT_EQ((graph::edge_list{{0, 1}, {0, 69}, {1, 0}, {3, 4}, {68, 2}, {69, 69}}),
+		m.edges());
+}
+
+TEST(Test_adjmatrix, layout_row_major) { test_layout<graph::layout::row_major>(); }
+
+TEST(Test_adjmatrix, layout_column_major) { test_layout<graph::layout::column_major>(); }
+
+TEST(Test_adjmatrix, layout_blocked) { test_layout<graph::layout::blocked<16>>(); }
+
+TEST(Test_adjmatrix, layout_blocked_storage_size)
+{
+	EXPECT_EQ(256u, graph::layout::blocked<16>::storage_size(16));
+	EXPECT_EQ(1024u, graph::layout::blocked<16>::storage_size(17));
+}
 }
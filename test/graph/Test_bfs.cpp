@@ -1,12 +1,27 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <tuple>
 #include <graph/bfs.hpp>
 #include <graph/adjmatrix.hpp>
+#include <graph/bitmatrix.hpp>
 #include <graph/adjlist.hpp>
+#include <graph/bidirectional_adjlist.hpp>
+#include <graph/csr.hpp>
+#include <graph/weighted_adjlist.hpp>
 
 namespace
 {
 using namespace graph;
 
+/// Graph providing only a list of outgoing vertices, no `at(edge)`.
+struct outgoing_only_graph {
+	using size_type = vertex;
+	std::vector<vertex_list> m;
+	size_type size() const { return m.size(); }
+	const vertex_list & outgoing(vertex v) const { return m[v]; }
+};
+
 class Test_bfs : public ::testing::Test
 {
 public:
@@ -33,6 +48,74 @@ public:
 			start, [&v](auto const &, auto vertex) { v.push_back(vertex); });
 		EXPECT_EQ(expected, v);
 	}
+
+	/// Returns the depth of all vertices, determined by breadth_first_search().
+	template <class Graph>
+	static std::vector<std::size_t> depth_of(const Graph & g, vertex start)
+	{
+		std::vector<std::size_t> depth(g.size(), breadth_first_tree::unreachable);
+		depth[start] = 0;
+		breadth_first_search(g, start, [&depth](const Graph & g, vertex u) {
+			for (auto const w : g.outgoing(u))
+				depth[w] = std::min(depth[w], depth[u] + 1);
+		});
+		return depth;
+	}
+
+	template <class Graph>
+	static void expect_direction_optimizing(const Graph & g, vertex start)
+	{
+		vertex_list visited;
+		const auto t = breadth_first_search_direction_optimizing(
+			g, start, [&visited](auto const &, vertex u) { visited.push_back(u); });
+
+		const auto depth = depth_of(g, start);
+		EXPECT_EQ(start, t.start);
+		EXPECT_EQ(depth, t.depth);
+		ASSERT_EQ(g.size(), t.parent.size());
+		EXPECT_EQ(vertex_invalid, t.parent[start]);
+
+		std::size_t reachable = 0;
+		for (vertex v = 0; v < g.size(); ++v) {
+			if (!t.reachable(v)) {
+				EXPECT_EQ(vertex_invalid, t.parent[v]);
+				continue;
+			}
+			++reachable;
+			if (v != start) {
+				const vertex p = t.parent[v];
+				ASSERT_NE(vertex_invalid, p);
+				EXPECT_EQ(t.depth[p] + 1, t.depth[v]);
+				EXPECT_TRUE(g.at({p, v}));
+			}
+		}
+
+		// each reachable vertex is visited exactly once, level by level
+		ASSERT_EQ(reachable, visited.size());
+		EXPECT_EQ(start, visited.front());
+		for (std::size_t i = 1; i < visited.size(); ++i)
+			EXPECT_LE(t.depth[visited[i - 1]], t.depth[visited[i]]);
+		auto sorted = visited;
+		std::sort(std::begin(sorted), std::end(sorted));
+		EXPECT_EQ(std::end(sorted), std::unique(std::begin(sorted), std::end(sorted)));
+	}
+
+	template <class Graph> void test_direction_optimizing() const
+	{
+		const Graph g{5, {{0, 1}, {1, 3}, {3, 0}, {2, 3}, {2, 4}, {3, 2}, {3, 4}}};
+		for (vertex v = 0; v < g.size(); ++v)
+			expect_direction_optimizing(g, v);
+	}
+
+	static bidirectional_adjlist random_graph(vertex n, std::size_t m, unsigned seed)
+	{
+		std::mt19937 rng{seed};
+		std::uniform_int_distribution<vertex> random_vertex{0, n - 1};
+		bidirectional_adjlist g{n};
+		for (std::size_t i = 0; i < m; ++i)
+			g.add(random_vertex(rng), random_vertex(rng));
+		return g;
+	}
 };
 
 TEST_F(Test_bfs, adjmatrix_empty_graph) { test_empty_graph<adjmatrix>(); }
@@ -74,4 +157,330 @@ TEST_F(Test_bfs, adjlist_graph_start_2) { test_bfs<adjlist>(vertex_list{2, 3, 4,
 TEST_F(Test_bfs, adjlist_graph_start_3) { test_bfs<adjlist>(vertex_list{3, 0, 2, 4, 1}, 3); }
 
 TEST_F(Test_bfs, adjlist_graph_start_4) { test_bfs<adjlist>(vertex_list{4}, 4); }
+
+TEST_F(Test_bfs, csr_empty_graph) { test_empty_graph<csr>(); }
+
+TEST_F(Test_bfs, csr_invalid_node) { test_invalid_node<csr>(); }
+
+TEST_F(Test_bfs, csr_graph_start_0) { test_bfs<csr>(vertex_list{0, 1, 3, 2, 4}, 0); }
+
+TEST_F(Test_bfs, csr_graph_start_1) { test_bfs<csr>(vertex_list{1, 3, 0, 2, 4}, 1); }
+
+TEST_F(Test_bfs, csr_graph_start_2) { test_bfs<csr>(vertex_list{2, 3, 4, 0, 1}, 2); }
+
+TEST_F(Test_bfs, csr_graph_start_3) { test_bfs<csr>(vertex_list{3, 0, 2, 4, 1}, 3); }
+
+TEST_F(Test_bfs, csr_graph_start_4) { test_bfs<csr>(vertex_list{4}, 4); }
+
+TEST_F(Test_bfs, bitmatrix_empty_graph) { test_empty_graph<bitmatrix>(); }
+
+TEST_F(Test_bfs, bitmatrix_invalid_node) { test_invalid_node<bitmatrix>(); }
+
+TEST_F(Test_bfs, bitmatrix_graph_start_0)
+{
+	test_bfs<bitmatrix>(vertex_list{0, 1, 3, 2, 4}, 0);
+}
+
+TEST_F(Test_bfs, bitmatrix_graph_start_1)
+{
+	test_bfs<bitmatrix>(vertex_list{1, 3, 0, 2, 4}, 1);
+}
+
+TEST_F(Test_bfs, bitmatrix_graph_start_2)
+{
+	test_bfs<bitmatrix>(vertex_list{2, 3, 4, 0, 1}, 2);
+}
+
+TEST_F(Test_bfs, bitmatrix_graph_start_3)
+{
+	test_bfs<bitmatrix>(vertex_list{3, 0, 2, 4, 1}, 3);
+}
+
+TEST_F(Test_bfs, bitmatrix_graph_start_4) { test_bfs<bitmatrix>(vertex_list{4}, 4); }
+
+TEST_F(Test_bfs, outgoing_only_graph)
+{
+	const outgoing_only_graph g{{{2, 1}, {}, {3}, {0, 1}}};
+	vertex_list v;
+	breadth_first_search(g, 0, [&v](auto const &, auto vertex) { v.push_back(vertex); });
+	EXPECT_EQ((vertex_list{0, 2, 1, 3}), v);
+}
+
+TEST_F(Test_bfs, bidirectional_adjlist_empty_graph)
+{
+	test_empty_graph<bidirectional_adjlist>();
+}
+
+TEST_F(Test_bfs, bidirectional_adjlist_invalid_node)
+{
+	test_invalid_node<bidirectional_adjlist>();
+}
+
+TEST_F(Test_bfs, bidirectional_adjlist_graph_start_0)
+{
+	test_bfs<bidirectional_adjlist>(vertex_list{0, 1, 3, 2, 4}, 0);
+}
+
+TEST_F(Test_bfs, bidirectional_adjlist_graph_start_1)
+{
+	test_bfs<bidirectional_adjlist>(vertex_list{1, 3, 0, 2, 4}, 1);
+}
+
+TEST_F(Test_bfs, bidirectional_adjlist_graph_start_2)
+{
+	test_bfs<bidirectional_adjlist>(vertex_list{2, 3, 4, 0, 1}, 2);
+}
+
+TEST_F(Test_bfs, bidirectional_adjlist_graph_start_3)
+{
+	test_bfs<bidirectional_adjlist>(vertex_list{3, 0, 2, 4, 1}, 3);
+}
+
+TEST_F(Test_bfs, bidirectional_adjlist_graph_start_4)
+{
+	test_bfs<bidirectional_adjlist>(vertex_list{4}, 4);
+}
+
+TEST_F(Test_bfs, sorted_adjlist_graph_start_0)
+{
+	test_bfs<sorted_adjlist>(vertex_list{0, 1, 3, 2, 4}, 0);
+}
+
+TEST_F(Test_bfs, weighted_adjlist_graph_start_0)
+{
+	test_bfs<weighted_adjlist<int>>(vertex_list{0, 1, 3, 2, 4}, 0);
+}
+
+TEST_F(Test_bfs, direction_optimizing_invalid_node)
+{
+	const auto t = breadth_first_search_direction_optimizing(bidirectional_adjlist{5}, 5);
+	EXPECT_EQ(vertex_invalid, t.start);
+	EXPECT_TRUE(t.depth.empty());
+	EXPECT_TRUE(t.parent.empty());
+	EXPECT_FALSE(t.reachable(0));
+	EXPECT_TRUE(t.path(0).empty());
+}
+
+TEST_F(Test_bfs, direction_optimizing_empty_graph)
+{
+	vertex_list v;
+	const auto t = breadth_first_search_direction_optimizing(bidirectional_adjlist{5}, 2,
+		[&v](auto const &, auto vertex) { v.push_back(vertex); });
+	EXPECT_EQ((vertex_list{2}), v);
+	EXPECT_EQ((std::vector<std::size_t>{breadth_first_tree::unreachable,
+				  breadth_first_tree::unreachable, 0, breadth_first_tree::unreachable,
+				  breadth_first_tree::unreachable}),
+		t.depth);
+	EXPECT_EQ((vertex_list{2}), t.path(2));
+	EXPECT_TRUE(t.path(0).empty());
+}
+
+TEST_F(Test_bfs, direction_optimizing_adjlist) { test_direction_optimizing<adjlist>(); }
+
+TEST_F(Test_bfs, direction_optimizing_adjmatrix) { test_direction_optimizing<adjmatrix>(); }
+
+TEST_F(Test_bfs, direction_optimizing_csr) { test_direction_optimizing<csr>(); }
+
+TEST_F(Test_bfs, direction_optimizing_bidirectional_adjlist)
+{
+	test_direction_optimizing<bidirectional_adjlist>();
+}
+
+TEST_F(Test_bfs, direction_optimizing_path)
+{
+	const bidirectional_adjlist g{5, {{0, 1}, {1, 3}, {3, 0}, {2, 3}, {2, 4}, {3, 2}, {3, 4}}};
+	const auto t = breadth_first_search_direction_optimizing(g, 0);
+	EXPECT_EQ((vertex_list{0, 1, 3, 4}), t.path(4));
+	EXPECT_EQ((vertex_list{0, 1, 3, 2}), t.path(2));
+	EXPECT_EQ((vertex_list{0}), t.path(0));
+}
+
+TEST_F(Test_bfs, direction_optimizing_line)
+{
+	const vertex n = 200;
+	bidirectional_adjlist g{n};
+	for (vertex v = 0; v + 1 < n; ++v)
+		g.add(v, v + 1, edge::type::bi);
+	expect_direction_optimizing(g, 0);
+	expect_direction_optimizing(g, n / 2);
+}
+
+TEST_F(Test_bfs, direction_optimizing_star)
+{
+	const vertex n = 300;
+	bidirectional_adjlist g{n};
+	for (vertex v = 1; v < n; ++v)
+		g.add(0, v, edge::type::bi);
+	expect_direction_optimizing(g, 0);
+	expect_direction_optimizing(g, 7);
+}
+
+TEST_F(Test_bfs, direction_optimizing_random_sparse_graph)
+{
+	const auto g = random_graph(1000, 1500, 1);
+	for (vertex v = 0; v < 10; ++v)
+		expect_direction_optimizing(g, v);
+}
+
+TEST_F(Test_bfs, direction_optimizing_random_dense_graph)
+{
+	const auto g = random_graph(1000, 16000, 2);
+	for (vertex v = 0; v < 10; ++v)
+		expect_direction_optimizing(g, v);
+}
+
+TEST_F(Test_bfs, multi_source_no_sources)
+{
+	EXPECT_TRUE(multi_source_breadth_first_search(adjlist{5}, vertex_list{}).empty());
+}
+
+TEST_F(Test_bfs, multi_source_invalid_source)
+{
+	const adjlist g{5, {{0, 1}, {1, 3}, {3, 0}, {2, 3}, {2, 4}, {3, 2}, {3, 4}}};
+	const auto depth = multi_source_breadth_first_search(g, vertex_list{5, 0});
+	ASSERT_EQ(2u, depth.size());
+	EXPECT_EQ(std::vector<std::size_t>(5, breadth_first_tree::unreachable), depth[0]);
+	EXPECT_EQ(depth_of(g, 0), depth[1]);
+}
+
+TEST_F(Test_bfs, multi_source_visitor)
+{
+	const adjlist g{5, {{0, 1}, {1, 3}, {3, 0}, {2, 3}, {2, 4}, {3, 2}, {3, 4}}};
+	std::vector<std::tuple<std::size_t, vertex, std::size_t>> found;
+	multi_source_breadth_first_search(g, vertex_list{4, 2, 2},
+		[&found](std::size_t source, vertex v, std::size_t depth) {
+			found.emplace_back(source, v, depth);
+		});
+	std::sort(std::begin(found), std::end(found));
+	EXPECT_EQ((std::vector<std::tuple<std::size_t, vertex, std::size_t>>{
+				  {0, 4, 0},
+				  {1, 0, 2}, {1, 1, 3}, {1, 2, 0}, {1, 3, 1}, {1, 4, 1},
+				  {2, 0, 2}, {2, 1, 3}, {2, 2, 0}, {2, 3, 1}, {2, 4, 1},
+			  }),
+		found);
+}
+
+TEST_F(Test_bfs, multi_source_same_as_single_source)
+{
+	const auto g = random_graph(500, 1200, 3);
+
+	// more than one batch, with some sources repeated
+	vertex_list sources;
+	for (vertex v = 0; v < 150; ++v)
+		sources.push_back((v * 7) % g.size());
+
+	const auto depth = multi_source_breadth_first_search(g, sources);
+	ASSERT_EQ(sources.size(), depth.size());
+	for (std::size_t i = 0; i < sources.size(); ++i)
+		EXPECT_EQ(depth_of(g, sources[i]), depth[i]);
+}
+
+TEST_F(Test_bfs, visitor_stop)
+{
+	const adjlist g{5, {{0, 1}, {1, 3}, {3, 0}, {2, 3}, {2, 4}, {3, 2}, {3, 4}}};
+
+	vertex_list v;
+	breadth_first_search(g, 2, [&v](auto const &, vertex x) {
+		v.push_back(x);
+		return (x == 4) ? visit_result::stop : visit_result::proceed;
+	});
+	EXPECT_EQ((vertex_list{2, 3, 4}), v);
+}
+
+TEST_F(Test_bfs, visitor_skip)
+{
+	const adjlist g{5, {{0, 1}, {1, 3}, {3, 0}, {2, 3}, {2, 4}, {3, 2}, {3, 4}}};
+
+	vertex_list v;
+	breadth_first_search(g, 2, [&v](auto const &, vertex x) {
+		v.push_back(x);
+		return (x == 3) ? visit_result::skip : visit_result::proceed;
+	});
+	EXPECT_EQ((vertex_list{2, 3, 4}), v);
+}
+
+TEST_F(Test_bfs, visitor_depth_limit)
+{
+	const auto g = random_graph(300, 900, 4);
+	const auto depth = depth_of(g, 0);
+	const std::size_t limit = 2;
+
+	// depth via the parent, as the search is level by level
+	std::vector<std::size_t> found(g.size(), breadth_first_tree::unreachable);
+	found[0] = 0;
+	breadth_first_search(g, 0, [&found, limit](const bidirectional_adjlist & g, vertex u) {
+		for (auto const w : g.outgoing(u))
+			found[w] = std::min(found[w], found[u] + 1);
+		return (found[u] == limit) ? visit_result::skip : visit_result::proceed;
+	});
+
+	for (vertex v = 0; v < g.size(); ++v) {
+		if (depth[v] <= limit + 1) {
+			EXPECT_EQ(depth[v], found[v]);
+		} else {
+			EXPECT_EQ(breadth_first_tree::unreachable, found[v]);
+		}
+	}
+}
+
+TEST_F(Test_bfs, visitor_other_return_type_ignored)
+{
+	const adjlist g{5, {{0, 1}, {1, 3}, {3, 0}, {2, 3}, {2, 4}, {3, 2}, {3, 4}}};
+
+	vertex_list v;
+	breadth_first_search(g, 0, [&v](auto const &, vertex x) {
+		v.push_back(x);
+		return false;
+	});
+	EXPECT_EQ((vertex_list{0, 1, 3, 2, 4}), v);
+}
+
+TEST_F(Test_bfs, reuse_workspace)
+{
+	const adjlist g{5, {{0, 1}, {1, 3}, {3, 0}, {2, 3}, {2, 4}, {3, 2}, {3, 4}}};
+
+	bfs_workspace ws;
+	vertex_list v;
+	breadth_first_search(g, 4, [&v](auto const &, vertex x) { v.push_back(x); }, ws);
+	EXPECT_EQ((vertex_list{4}), v);
+	EXPECT_EQ((vertex_list{4}), ws.queue);
+	EXPECT_EQ(1u, ws.visited.count());
+	EXPECT_TRUE(ws.visited.test(4));
+
+	v.clear();
+	breadth_first_search(g, 2, [&v](auto const &, vertex x) { v.push_back(x); }, ws);
+	EXPECT_EQ((vertex_list{2, 3, 4, 0, 1}), v);
+	EXPECT_EQ((vertex_list{2, 3, 4, 0, 1}), ws.queue);
+	EXPECT_EQ(5u, ws.visited.count());
+}
+
+TEST_F(Test_bfs, reuse_workspace_keeps_capacity)
+{
+	const auto g = random_graph(1000, 4000, 5);
+
+	// the buffers grow to the largest search once
+	bfs_workspace ws;
+	for (vertex v = 0; v < 20; ++v)
+		breadth_first_search(g, v, [](auto const &, vertex) {}, ws);
+	ASSERT_FALSE(ws.queue.empty());
+	const auto capacity = ws.queue.capacity();
+	const auto data = ws.queue.data();
+
+	for (vertex v = 0; v < 20; ++v) {
+		breadth_first_search(g, v, [](auto const &, vertex) {}, ws);
+		EXPECT_EQ(capacity, ws.queue.capacity());
+		EXPECT_EQ(data, ws.queue.data());
+	}
+}
+
+TEST_F(Test_bfs, workspace_with_stop)
+{
+	const adjlist g{5, {{0, 1}, {1, 3}, {3, 0}, {2, 3}, {2, 4}, {3, 2}, {3, 4}}};
+
+	bfs_workspace ws;
+	breadth_first_search(g, 2, [](auto const &, vertex) { return visit_result::stop; }, ws);
+	EXPECT_EQ(1u, ws.visited.count());
+	EXPECT_TRUE(ws.visited.test(2));
+	EXPECT_EQ((vertex_list{2}), ws.queue);
+}
 }
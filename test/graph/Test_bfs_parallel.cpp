@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <graph/bfs_parallel.hpp>
+#include <graph/adjmatrix.hpp>
+#include <graph/adjlist.hpp>
+#include <graph/csr.hpp>
+
+namespace
+{
+using namespace graph;
+
+class Test_bfs_parallel : public ::testing::Test
+{
+public:
+	static adjlist create_random(vertex n, std::size_t m, unsigned seed)
+	{
+		std::mt19937 rng{seed};
+		std::uniform_int_distribution<vertex> random_vertex{0, n - 1};
+
+		adjlist g{n};
+		for (std::size_t i = 0; i < m; ++i)
+			g.add(random_vertex(rng), random_vertex(rng));
+		return g;
+	}
+
+	/// Checks the depths against the sequential search, the parents
+	/// for consistency with the depths (ties may lead to other trees), and
+	/// that the visitor saw each reachable vertex once, level by level.
+	template <class Graph>
+	static void expect_same_as_sequential(
+		const Graph & g, vertex start, utils::thread_pool & pool)
+	{
+		std::mutex mtx;
+		vertex_list visited;
+		const auto t = breadth_first_search_parallel(
+			g, start,
+			[&](const Graph &, vertex u) {
+				std::lock_guard<std::mutex> lock(mtx);
+				visited.push_back(u);
+			},
+			pool);
+
+		// depths of the sequential search, which visits level by level
+		std::vector<std::size_t> depth(g.size(), breadth_first_tree::unreachable);
+		depth[start] = 0;
+		breadth_first_search(g, start, [&depth](const Graph & g, vertex u) {
+			for (auto const w : g.outgoing(u))
+				depth[w] = std::min(depth[w], depth[u] + 1);
+		});
+
+		ASSERT_EQ(start, t.start);
+		ASSERT_EQ(depth, t.depth);
+		ASSERT_EQ(g.size(), t.parent.size());
+		EXPECT_EQ(vertex_invalid, t.parent[start]);
+		for (vertex v = 0; v < g.size(); ++v) {
+			const vertex p = t.parent[v];
+			if (p != vertex_invalid) {
+				EXPECT_TRUE(g.at({p, v}));
+				EXPECT_EQ(t.depth[p] + 1, t.depth[v]);
+			} else if (v != start) {
+				EXPECT_FALSE(t.reachable(v));
+			}
+		}
+
+		const auto reachable = std::count_if(std::begin(t.depth), std::end(t.depth),
+			[](std::size_t d) { return d != breadth_first_tree::unreachable; });
+		ASSERT_EQ(static_cast<std::size_t>(reachable), visited.size());
+		for (std::size_t i = 1; i < visited.size(); ++i)
+			EXPECT_LE(t.depth[visited[i - 1]], t.depth[visited[i]]);
+		std::sort(std::begin(visited), std::end(visited));
+		EXPECT_EQ(std::end(visited), std::unique(std::begin(visited), std::end(visited)));
+	}
+};
+
+TEST_F(Test_bfs_parallel, invalid_node)
+{
+	utils::thread_pool pool(2);
+	const auto t = breadth_first_search_parallel(adjlist{5}, 5, pool);
+	EXPECT_EQ(vertex_invalid, t.start);
+	EXPECT_TRUE(t.depth.empty());
+	EXPECT_TRUE(t.parent.empty());
+}
+
+TEST_F(Test_bfs_parallel, empty_graph)
+{
+	utils::thread_pool pool(2);
+	std::atomic<int> count{0};
+	const auto t = breadth_first_search_parallel(
+		adjlist{5}, 3, [&count](auto const &, vertex) { ++count; }, pool);
+	EXPECT_EQ(1, count);
+	EXPECT_EQ((vertex_list{3}), t.path(3));
+	EXPECT_FALSE(t.reachable(0));
+}
+
+TEST_F(Test_bfs_parallel, simple)
+{
+	const adjlist g_adjlist{5, {{0, 1}, {1, 3}, {3, 0}, {2, 3}, {2, 4}, {3, 2}, {3, 4}}};
+	const adjmatrix g_adjmatrix{5, {{0, 1}, {1, 3}, {3, 0}, {2, 3}, {2, 4}, {3, 2}, {3, 4}}};
+	const csr g_csr{5, {{0, 1}, {1, 3}, {3, 0}, {2, 3}, {2, 4}, {3, 2}, {3, 4}}};
+	utils::thread_pool pool(2);
+
+	for (vertex start = 0; start < 5; ++start) {
+		expect_same_as_sequential(g_adjlist, start, pool);
+		expect_same_as_sequential(g_adjmatrix, start, pool);
+		expect_same_as_sequential(g_csr, start, pool);
+	}
+	EXPECT_EQ((vertex_list{0, 1, 3, 4}),
+		breadth_first_search_parallel(g_adjlist, 0, pool).path(4));
+}
+
+TEST_F(Test_bfs_parallel, line)
+{
+	const vertex n = 300;
+	adjlist g{n};
+	for (vertex v = 0; v + 1 < n; ++v)
+		g.add(v, v + 1, edge::type::bi);
+	utils::thread_pool pool(3);
+
+	expect_same_as_sequential(g, 0, pool);
+	expect_same_as_sequential(g, n / 2, pool);
+}
+
+TEST_F(Test_bfs_parallel, random_graph)
+{
+	const auto g = create_random(2000, 12000, 7);
+
+	for (std::size_t threads = 1; threads <= 4; threads *= 2) {
+		utils::thread_pool pool(threads);
+		for (vertex start = 0; start < 5; ++start)
+			expect_same_as_sequential(g, start, pool);
+	}
+}
+}
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <graph/bidirectional_adjlist.hpp>
+
+namespace
+{
+
+TEST(Test_bidirectional_adjlist, default_construction)
+{
+	EXPECT_NO_THROW(graph::bidirectional_adjlist g{4});
+}
+
+TEST(Test_bidirectional_adjlist, default_construction_status)
+{
+	const graph::bidirectional_adjlist g{4};
+	EXPECT_EQ(4u, g.size());
+	EXPECT_EQ(0u, g.count_edges());
+}
+
+TEST(Test_bidirectional_adjlist, construction_initializer_list)
+{
+	const graph::bidirectional_adjlist g{4, {{0, 1}, {0, 2}, {1, 3}}};
+	EXPECT_EQ(4u, g.size());
+	EXPECT_EQ(3u, g.count_edges());
+}
+
+TEST(Test_bidirectional_adjlist, add_edges_out_of_range)
+{
+	graph::bidirectional_adjlist m{4};
+
+	EXPECT_FALSE(m.add(0, 4));
+	EXPECT_FALSE(m.add(4, 0));
+	EXPECT_EQ(0u, m.count_edges());
+}
+
+TEST(Test_bidirectional_adjlist, add_edges_bidirectional)
+{
+	graph::bidirectional_adjlist m{2};
+
+	EXPECT_TRUE(m.add(0, 1, graph::edge::type::bi));
+	EXPECT_EQ(2u, m.count_edges());
+	EXPECT_EQ((graph::vertex_list{1}), m.incoming(0));
+	EXPECT_EQ((graph::vertex_list{0}), m.incoming(1));
+}
+
+TEST(Test_bidirectional_adjlist, incoming)
+{
+	graph::bidirectional_adjlist m{4, {{0, 1}, {0, 2}, {0, 3}, {1, 0}, {1, 2}}};
+
+	EXPECT_EQ((graph::vertex_list{1}), m.incoming(0));
+	EXPECT_EQ((graph::vertex_list{0}), m.incoming(1));
+	EXPECT_EQ((graph::vertex_list{0, 1}), m.incoming(2));
+	EXPECT_EQ((graph::vertex_list{0}), m.incoming(3));
+	EXPECT_EQ(2u, m.count_incoming(2));
+	EXPECT_EQ(0u, m.count_incoming(4));
+}
+
+TEST(Test_bidirectional_adjlist, outgoing)
+{
+	graph::bidirectional_adjlist m{4, {{0, 1}, {0, 2}, {0, 3}, {1, 0}, {1, 2}}};
+
+	EXPECT_EQ(3u, m.outgoing(0).size());
+	EXPECT_EQ(2u, m.outgoing(1).size());
+	EXPECT_EQ(0u, m.outgoing(2).size());
+	EXPECT_EQ(0u, m.outgoing(3).size());
+	EXPECT_EQ(3u, m.count_outgoing(0));
+}
+
+TEST(Test_bidirectional_adjlist, remove)
+{
+	graph::bidirectional_adjlist m{4, {{0, 1}, {0, 2}, {0, 3}, {1, 0}, {1, 2}}};
+
+	m.remove({0, 2});
+
+	EXPECT_EQ(4u, m.count_edges());
+	EXPECT_FALSE(m.at(0, 2));
+	EXPECT_EQ((graph::vertex_list{1}), m.incoming(2));
+}
+
+TEST(Test_bidirectional_adjlist, remove_bidirectional)
+{
+	graph::bidirectional_adjlist m{3, {{0, 1}, {1, 0}, {1, 2}}};
+
+	m.remove(0, 1, graph::edge::type::bi);
+
+	EXPECT_EQ(1u, m.count_edges());
+	EXPECT_EQ(0u, m.count_incoming(0));
+	EXPECT_EQ(0u, m.count_incoming(1));
+	EXPECT_EQ(1u, m.count_incoming(2));
+}
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <graph/bitmatrix.hpp>
+
+namespace
+{
+
+TEST(Test_bitmatrix, default_construction) { EXPECT_NO_THROW(graph::bitmatrix g{4}); }
+
+TEST(Test_bitmatrix, default_construction_status)
+{
+	const graph::bitmatrix g{4};
+	EXPECT_EQ(4u, g.size());
+	EXPECT_EQ(0u, g.count_edges());
+}
+
+TEST(Test_bitmatrix, construction_initializer_list)
+{
+	const graph::bitmatrix g{4, {{0, 1}, {0, 2}, {1, 3}}};
+	EXPECT_EQ(4u, g.size());
+	EXPECT_EQ(3u, g.count_edges());
+}
+
+TEST(Test_bitmatrix, add_edges)
+{
+	graph::bitmatrix m{4};
+
+	EXPECT_EQ(0u, m.count_edges());
+	m.add(0, 1);
+	EXPECT_EQ(1u, m.count_edges());
+	m.add(1, 2);
+	EXPECT_EQ(2u, m.count_edges());
+	m.add(1, 2);
+	EXPECT_EQ(2u, m.count_edges());
+}
+
+TEST(Test_bitmatrix, add_edges_out_of_range)
+{
+	graph::bitmatrix m{4};
+
+	EXPECT_FALSE(m.add(0, 4));
+	EXPECT_FALSE(m.add(4, 0));
+}
+
+TEST(Test_bitmatrix, add_edges_bidirectional)
+{
+	graph::bitmatrix m{2};
+
+	EXPECT_TRUE(m.add(0, 1, graph::edge::type::bi));
+	EXPECT_EQ(2u, m.count_edges());
+	EXPECT_TRUE(m.at(0, 1));
+	EXPECT_TRUE(m.at(1, 0));
+}
+
+TEST(Test_bitmatrix, incoming)
+{
+	graph::bitmatrix m{4, {{0, 1}, {0, 2}, {0, 3}, {1, 0}, {1, 2}}};
+
+	EXPECT_EQ(1u, m.incoming(0).size());
+	EXPECT_EQ(1u, m.incoming(1).size());
+	EXPECT_EQ(2u, m.incoming(2).size());
+	EXPECT_EQ(1u, m.incoming(3).size());
+	EXPECT_EQ(2u, m.count_incoming(2));
+}
+
+TEST(Test_bitmatrix, outgoing)
+{
+	graph::bitmatrix m{4, {{0, 1}, {0, 2}, {0, 3}, {1, 0}, {1, 2}}};
+
+	EXPECT_EQ((graph::vertex_list{1, 2, 3}), m.outgoing(0));
+	EXPECT_EQ((graph::vertex_list{0, 2}), m.outgoing(1));
+	EXPECT_EQ(0u, m.outgoing(2).size());
+	EXPECT_EQ(0u, m.outgoing(3).size());
+	EXPECT_EQ(3u, m.count_outgoing(0));
+}
+
+TEST(Test_bitmatrix, word_boundaries)
+{
+	graph::bitmatrix m{130, {{0, 63}, {0, 64}, {0, 129}, {129, 0}, {129, 128}}};
+
+	EXPECT_EQ((graph::vertex_list{63, 64, 129}), m.outgoing(0));
+	EXPECT_EQ(3u, m.count_outgoing(0));
+	EXPECT_EQ((graph::vertex_list{0, 128}), m.outgoing(129));
+	EXPECT_EQ(0u, m.count_outgoing(128));
+	EXPECT_EQ(5u, m.count_edges());
+	EXPECT_EQ((graph::edge_list{{0, 63}, {0, 64}, {0, 129}, {129, 0}, {129, 128}}), m.edges());
+}
+
+TEST(Test_bitmatrix, remove)
+{
+	graph::bitmatrix m{4, {{0, 1}, {0, 2}, {0, 3}, {1, 0}, {1, 2}}};
+
+	EXPECT_EQ(4u, m.size());
+	EXPECT_EQ(5u, m.count_edges());
+
+	m.remove({0, 1});
+
+	EXPECT_EQ(4u, m.size());
+	EXPECT_EQ(4u, m.count_edges());
+	EXPECT_FALSE(m.at(0, 1));
+}
+
+TEST(Test_bitmatrix, vertices)
+{
+	graph::bitmatrix m{4};
+
+	const auto v = m.vertices();
+
+	EXPECT_EQ((graph::vertex_list{0, 1, 2, 3}), v);
+}
+}
@@ -0,0 +1,253 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <graph/contraction_hierarchy.hpp>
+#include <graph/adjmatrix.hpp>
+#include <graph/adjlist.hpp>
+#include <graph/weighted_adjlist.hpp>
+#include <graph/edge_property_map.hpp>
+
+namespace
+{
+using namespace graph;
+
+class Test_contraction_hierarchy : public ::testing::Test
+{
+public:
+	static adjmatrix create_cycle_uni()
+	{
+		adjmatrix g{5};
+		g.add(0, 1, edge::type::uni, 1);
+		g.add(0, 2, edge::type::uni, 2);
+		g.add(1, 2, edge::type::uni, 2);
+		g.add(1, 3, edge::type::uni, 3);
+		g.add(2, 3, edge::type::uni, 1);
+		g.add(2, 4, edge::type::uni, 5);
+		g.add(3, 4, edge::type::uni, 1);
+		g.add(4, 0, edge::type::uni, 4);
+		g.add(3, 0, edge::type::uni, 2);
+		g.add(3, 1, edge::type::uni, 1);
+		return g;
+	}
+
+	/// Returns the length of the path, or -1 if it contains an edge which
+	/// does not exist in the graph.
+	template <class Graph, class Distances>
+	static int length(const Graph & g, const Distances & distances, const vertex_list & path)
+	{
+		int sum = 0;
+		for (std::size_t i = 1; i < path.size(); ++i) {
+			if (!g.at(path[i - 1], path[i]))
+				return -1;
+			sum += distances(path[i - 1], path[i]);
+		}
+		return sum;
+	}
+
+	/// Compares the results of the hierarchy with Dijkstra, for the specified pairs.
+	template <class Graph, class Hierarchy, class Distances>
+	static void expect_shortest_paths(const Graph & g, const Hierarchy & ch,
+		const Distances & distances, const std::vector<edge> & pairs)
+	{
+		dijkstra_workspace<typename Hierarchy::value_type> forward{ch.size()};
+		dijkstra_workspace<typename Hierarchy::value_type> backward{ch.size()};
+		vertex_list path;
+
+		for (auto const & e : pairs) {
+			vertex_list expected;
+			bool expected_found;
+			std::tie(expected, expected_found) = shortest_path_dijkstra(g, e.from, e.to);
+
+			const bool found = shortest_path_contraction_hierarchy(
+				ch, e.from, e.to, forward, backward, path);
+
+			ASSERT_EQ(expected_found, found) << e.from << " -> " << e.to;
+			if (found) {
+				EXPECT_EQ(e.from, path.front());
+				EXPECT_EQ(e.to, path.back());
+				EXPECT_EQ(length(g, distances, expected), length(g, distances, path))
+					<< e.from << " -> " << e.to;
+			} else {
+				EXPECT_TRUE(path.empty());
+			}
+		}
+	}
+};
+
+TEST_F(Test_contraction_hierarchy, construction)
+{
+	const auto g = create_cycle_uni();
+	const contraction_hierarchy<int> ch{g};
+
+	EXPECT_EQ(g.size(), ch.size());
+	EXPECT_GE(ch.count_edges(), g.count_edges());
+	EXPECT_EQ(ch.count_edges(), g.count_edges() + ch.count_shortcuts());
+
+	// ranks are a permutation of the vertices
+	vertex_list ranks;
+	for (vertex v = 0; v < ch.size(); ++v)
+		ranks.push_back(ch.rank(v));
+	std::sort(std::begin(ranks), std::end(ranks));
+	EXPECT_EQ((vertex_list{0, 1, 2, 3, 4}), ranks);
+}
+
+TEST_F(Test_contraction_hierarchy, edges_lead_upwards)
+{
+	const contraction_hierarchy<int> ch{create_cycle_uni()};
+
+	for (vertex v = 0; v < ch.size(); ++v) {
+		ch.for_each_upward(v, [&](vertex w, int) { EXPECT_GT(ch.rank(w), ch.rank(v)); });
+		ch.for_each_downward(v, [&](vertex u, int) { EXPECT_GT(ch.rank(u), ch.rank(v)); });
+	}
+}
+
+TEST_F(Test_contraction_hierarchy, shortcut_for_line)
+{
+	// the middle vertex has the lowest priority, contracting it needs shortcuts
+	adjmatrix g{3};
+	g.add(0, 1, edge::type::bi, 2);
+	g.add(1, 2, edge::type::bi, 3);
+	const contraction_hierarchy<int> ch{g};
+
+	vertex_list v;
+	bool success;
+	std::tie(v, success) = shortest_path_contraction_hierarchy(ch, 0, 2);
+	EXPECT_TRUE(success);
+	EXPECT_EQ((vertex_list{0, 1, 2}), v);
+
+	std::tie(v, success) = shortest_path_contraction_hierarchy(ch, 2, 0);
+	EXPECT_TRUE(success);
+	EXPECT_EQ((vertex_list{2, 1, 0}), v);
+}
+
+TEST_F(Test_contraction_hierarchy, all_pairs_cycle_uni)
+{
+	const auto g = create_cycle_uni();
+	const contraction_hierarchy<int> ch{g};
+
+	std::vector<edge> pairs;
+	for (vertex u = 0; u < g.size(); ++u)
+		for (vertex v = 0; v < g.size(); ++v)
+			pairs.emplace_back(u, v);
+
+	expect_shortest_paths(
+		g, ch, [&g](vertex u, vertex v) { return g.at(u, v); }, pairs);
+}
+
+TEST_F(Test_contraction_hierarchy, start_is_destination)
+{
+	const contraction_hierarchy<int> ch{create_cycle_uni()};
+
+	vertex_list v;
+	bool success;
+	std::tie(v, success) = shortest_path_contraction_hierarchy(ch, 2, 2);
+
+	EXPECT_TRUE(success);
+	EXPECT_EQ((vertex_list{2}), v);
+}
+
+TEST_F(Test_contraction_hierarchy, unreachable_destination)
+{
+	adjmatrix g{4};
+	g.add(0, 1, edge::type::uni, 1);
+	g.add(2, 3, edge::type::bi, 1);
+	const contraction_hierarchy<int> ch{g};
+
+	vertex_list v;
+	bool reachable;
+	std::tie(v, reachable) = shortest_path_contraction_hierarchy(ch, 1, 0);
+	EXPECT_FALSE(reachable);
+	EXPECT_TRUE(v.empty());
+
+	std::tie(v, reachable) = shortest_path_contraction_hierarchy(ch, 0, 3);
+	EXPECT_FALSE(reachable);
+	EXPECT_TRUE(v.empty());
+}
+
+TEST_F(Test_contraction_hierarchy, invalid_vertices)
+{
+	const contraction_hierarchy<int> ch{create_cycle_uni()};
+
+	EXPECT_FALSE(std::get<1>(shortest_path_contraction_hierarchy(ch, 5, 0)));
+	EXPECT_FALSE(std::get<1>(shortest_path_contraction_hierarchy(ch, 0, 5)));
+}
+
+TEST_F(Test_contraction_hierarchy, workspaces_too_small)
+{
+	const contraction_hierarchy<int> ch{create_cycle_uni()};
+	dijkstra_workspace<int> forward{ch.size()};
+	dijkstra_workspace<int> backward{2};
+	vertex_list path{1, 2};
+
+	EXPECT_FALSE(shortest_path_contraction_hierarchy(ch, 0, 4, forward, backward, path));
+	EXPECT_TRUE(path.empty());
+}
+
+TEST_F(Test_contraction_hierarchy, with_property_maps)
+{
+	const adjlist g{5,
+		{{0, 1}, {0, 2}, {1, 2}, {1, 3}, {2, 3}, {2, 4}, {3, 4}, {4, 0}, {3, 0}, {3, 1}}};
+	const std::map<edge, int> distances{
+		{{0, 1}, 1}, {{0, 2}, 2}, {{1, 2}, 2}, {{1, 3}, 3}, {{2, 3}, 1}, {{2, 4}, 5},
+		{{3, 4}, 1}, {{4, 0}, 4}, {{3, 0}, 2}, {{3, 1}, 1},
+	};
+	edge_property_map<int> p{g};
+	for (auto const & d : distances)
+		p.set(g, d.first, d.second);
+
+	const contraction_hierarchy<int> ch_map{g, distances};
+	const contraction_hierarchy<int> ch_property_map{g, p};
+
+	EXPECT_EQ((std::make_tuple(vertex_list{2, 3, 4}, true)),
+		shortest_path_contraction_hierarchy(ch_map, 2, 4));
+	EXPECT_EQ((std::make_tuple(vertex_list{3, 1, 2}, true)),
+		shortest_path_contraction_hierarchy(ch_property_map, 3, 2));
+}
+
+TEST_F(Test_contraction_hierarchy, random_graph)
+{
+	const vertex n = 150;
+	std::mt19937 rng{3};
+	std::uniform_int_distribution<vertex> random_vertex{0, n - 1};
+	std::uniform_int_distribution<int> random_weight{1, 20};
+
+	weighted_adjlist<int> g{n};
+	for (int i = 0; i < 450; ++i)
+		g.add({random_vertex(rng), random_vertex(rng)}, edge::type::uni, random_weight(rng));
+	const contraction_hierarchy<int> ch{g};
+
+	std::vector<edge> pairs;
+	for (int i = 0; i < 500; ++i)
+		pairs.emplace_back(random_vertex(rng), random_vertex(rng));
+
+	expect_shortest_paths(
+		g, ch, [&g](vertex u, vertex v) { return g.at(u, v); }, pairs);
+}
+
+TEST_F(Test_contraction_hierarchy, grid)
+{
+	const vertex side = 20;
+	std::mt19937 rng{5};
+	std::uniform_int_distribution<int> random_weight{1, 9};
+
+	weighted_adjlist<int> g{side * side};
+	for (vertex y = 0; y < side; ++y) {
+		for (vertex x = 0; x < side; ++x) {
+			const vertex v = y * side + x;
+			if (x + 1 < side)
+				g.add({v, v + 1}, edge::type::bi, random_weight(rng));
+			if (y + 1 < side)
+				g.add({v, v + side}, edge::type::bi, random_weight(rng));
+		}
+	}
+	const contraction_hierarchy<int> ch{g};
+
+	std::uniform_int_distribution<vertex> random_vertex{0, g.size() - 1};
+	std::vector<edge> pairs;
+	for (int i = 0; i < 500; ++i)
+		pairs.emplace_back(random_vertex(rng), random_vertex(rng));
+
+	expect_shortest_paths(
+		g, ch, [&g](vertex u, vertex v) { return g.at(u, v); }, pairs);
+}
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <graph/csr.hpp>
+
+namespace
+{
+
+TEST(Test_csr, default_construction) { EXPECT_NO_THROW(graph::csr g{4}); }
+
+TEST(Test_csr, default_construction_status)
+{
+	const graph::csr g{4};
+	EXPECT_EQ(4u, g.size());
+	EXPECT_EQ(0u, g.count_edges());
+}
+
+TEST(Test_csr, construction_initializer_list)
+{
+	const graph::csr g{4, {{0, 1}, {0, 2}, {1, 3}}};
+	EXPECT_EQ(4u, g.size());
+	EXPECT_EQ(3u, g.count_edges());
+}
+
+TEST(Test_csr, construction_edge_list)
+{
+	const graph::edge_list edges{{2, 0}, {0, 2}, {0, 1}, {1, 3}};
+	const graph::csr g{4, edges};
+	EXPECT_EQ(4u, g.size());
+	EXPECT_EQ(4u, g.count_edges());
+}
+
+TEST(Test_csr, construction_ignores_duplicates)
+{
+	const graph::csr g{4, {{0, 1}, {0, 2}, {0, 1}, {1, 3}, {0, 2}}};
+	EXPECT_EQ(3u, g.count_edges());
+	EXPECT_EQ(2u, g.count_outgoing(0));
+}
+
+TEST(Test_csr, construction_ignores_out_of_range)
+{
+	const graph::csr g{4, {{0, 4}, {4, 0}, {1, 3}}};
+	EXPECT_EQ(1u, g.count_edges());
+}
+
+TEST(Test_csr, at)
+{
+	const graph::csr g{4, {{0, 2}, {0, 1}, {1, 3}}};
+
+	EXPECT_TRUE(g.at(0, 1));
+	EXPECT_TRUE(g.at(0, 2));
+	EXPECT_TRUE(g.at(1, 3));
+	EXPECT_FALSE(g.at(1, 0));
+	EXPECT_FALSE(g.at(0, 3));
+	EXPECT_FALSE(g.at(3, 3));
+}
+
+TEST(Test_csr, incoming)
+{
+	const graph::csr m{4, {{0, 1}, {0, 2}, {0, 3}, {1, 0}, {1, 2}}};
+
+	EXPECT_EQ(1u, m.incoming(0).size());
+	EXPECT_EQ(1u, m.incoming(1).size());
+	EXPECT_EQ(2u, m.incoming(2).size());
+	EXPECT_EQ(1u, m.incoming(3).size());
+	EXPECT_EQ(2u, m.count_incoming(2));
+}
+
+TEST(Test_csr, outgoing)
+{
+	const graph::csr m{4, {{0, 1}, {0, 2}, {0, 3}, {1, 0}, {1, 2}}};
+
+	EXPECT_EQ(3u, m.outgoing(0).size());
+	EXPECT_EQ(2u, m.outgoing(1).size());
+	EXPECT_EQ(0u, m.outgoing(2).size());
+	EXPECT_EQ(0u, m.outgoing(3).size());
+	EXPECT_EQ(0u, m.outgoing(4).size());
+}
+
+TEST(Test_csr, outgoing_sorted)
+{
+	const graph::csr m{4, {{0, 3}, {0, 1}, {0, 2}}};
+
+	EXPECT_EQ((graph::vertex_list{1, 2, 3}), m.outgoing(0));
+}
+
+TEST(Test_csr, edges)
+{
+	const graph::csr m{4, {{1, 2}, {0, 3}, {0, 1}}};
+
+	EXPECT_EQ((graph::edge_list{{0, 1}, {0, 3}, {1, 2}}), m.edges());
+}
+
+TEST(Test_csr, vertices)
+{
+	graph::csr m{4};
+
+	const auto v = m.vertices();
+
+	EXPECT_EQ((graph::vertex_list{0, 1, 2, 3}), v);
+}
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <graph/delta_stepping.hpp>
+#include <graph/adjmatrix.hpp>
+#include <graph/adjlist.hpp>
+#include <graph/weighted_adjlist.hpp>
+#include <graph/edge_property_map.hpp>
+
+namespace
+{
+using namespace graph;
+
+class Test_delta_stepping : public ::testing::Test
+{
+public:
+	static adjmatrix create_cycle_uni()
+	{
+		adjmatrix g{5};
+		g.add(0, 1, edge::type::uni, 1);
+		g.add(0, 2, edge::type::uni, 2);
+		g.add(1, 2, edge::type::uni, 2);
+		g.add(1, 3, edge::type::uni, 3);
+		g.add(2, 3, edge::type::uni, 1);
+		g.add(2, 4, edge::type::uni, 5);
+		g.add(3, 4, edge::type::uni, 1);
+		g.add(4, 0, edge::type::uni, 4);
+		g.add(3, 0, edge::type::uni, 2);
+		g.add(3, 1, edge::type::uni, 1);
+		return g;
+	}
+
+	static weighted_adjlist<int> create_random(vertex n, std::size_t m, unsigned seed)
+	{
+		std::mt19937 rng{seed};
+		std::uniform_int_distribution<vertex> random_vertex{0, n - 1};
+		std::uniform_int_distribution<int> random_weight{1, 50};
+
+		weighted_adjlist<int> g{n};
+		for (std::size_t i = 0; i < m; ++i) {
+			const edge e{random_vertex(rng), random_vertex(rng)};
+			g.add(e, edge::type::uni, random_weight(rng));
+		}
+		return g;
+	}
+
+	/// Checks the distances against Dijkstra, and the predecessors for
+	/// consistency with the distances (ties may lead to other trees).
+	template <class Graph>
+	static void expect_same_as_dijkstra(
+		const Graph & g, const shortest_path_tree<int> & tree, vertex start)
+	{
+		const auto expected = shortest_paths_dijkstra(g, start);
+
+		ASSERT_EQ(start, tree.start);
+		ASSERT_EQ(expected.distance, tree.distance);
+		EXPECT_EQ(vertex_invalid, tree.predecessor[start]);
+		for (vertex v = 0; v < g.size(); ++v) {
+			const vertex u = tree.predecessor[v];
+			if (u != vertex_invalid) {
+				EXPECT_EQ(tree.distance[v], tree.distance[u] + g.at(u, v));
+			} else if (v != start) {
+				EXPECT_FALSE(tree.reachable(v));
+			}
+		}
+	}
+};
+
+TEST_F(Test_delta_stepping, cycle_uni)
+{
+	const auto g = create_cycle_uni();
+	utils::thread_pool pool(2);
+
+	for (vertex start = 0; start < g.size(); ++start)
+		expect_same_as_dijkstra(g, shortest_paths_delta_stepping(g, start, 2, pool), start);
+}
+
+TEST_F(Test_delta_stepping, path)
+{
+	utils::thread_pool pool(2);
+	const auto tree = shortest_paths_delta_stepping(create_cycle_uni(), 0, 1, pool);
+
+	EXPECT_EQ((vertex_list{0, 2, 3, 4}), tree.path(4));
+	EXPECT_EQ(4, tree.distance[4]);
+}
+
+TEST_F(Test_delta_stepping, unreachable_vertices)
+{
+	adjmatrix g{4};
+	g.add(0, 1, edge::type::uni, 1);
+	g.add(2, 3, edge::type::uni, 1);
+	utils::thread_pool pool(2);
+
+	const auto tree = shortest_paths_delta_stepping(g, 0, 1, pool);
+
+	EXPECT_TRUE(tree.reachable(1));
+	EXPECT_FALSE(tree.reachable(2));
+	EXPECT_FALSE(tree.reachable(3));
+	EXPECT_EQ(vertex_invalid, tree.predecessor[3]);
+}
+
+TEST_F(Test_delta_stepping, invalid_arguments)
+{
+	utils::thread_pool pool(1);
+
+	auto tree = shortest_paths_delta_stepping(create_cycle_uni(), 5, 1, pool);
+	EXPECT_TRUE(tree.distance.empty());
+	EXPECT_TRUE(tree.predecessor.empty());
+
+	tree = shortest_paths_delta_stepping(create_cycle_uni(), 0, 0, pool);
+	EXPECT_TRUE(tree.distance.empty());
+}
+
+TEST_F(Test_delta_stepping, with_property_maps)
+{
+	const adjlist g{5,
+		{{0, 1}, {0, 2}, {1, 2}, {1, 3}, {2, 3}, {2, 4}, {3, 4}, {4, 0}, {3, 0}, {3, 1}}};
+	const std::map<edge, int> distances{
+		{{0, 1}, 1}, {{0, 2}, 2}, {{1, 2}, 2}, {{1, 3}, 3}, {{2, 3}, 1}, {{2, 4}, 5},
+		{{3, 4}, 1}, {{4, 0}, 4}, {{3, 0}, 2}, {{3, 1}, 1},
+	};
+	edge_property_map<int> p{g};
+	for (auto const & d : distances)
+		p.set(g, d.first, d.second);
+	utils::thread_pool pool(3);
+
+	const auto expected = shortest_paths_dijkstra(g, distances, 2);
+	EXPECT_EQ(expected.distance,
+		shortest_paths_delta_stepping(g, distances, 2, 2, pool).distance);
+	EXPECT_EQ(expected.distance, shortest_paths_delta_stepping(g, p, 2, 3, pool).distance);
+}
+
+TEST_F(Test_delta_stepping, random_graphs)
+{
+	for (unsigned seed = 0; seed < 4; ++seed) {
+		const auto g = create_random(300, 1500, seed);
+		for (std::size_t threads : {1, 2, 4}) {
+			utils::thread_pool pool(threads);
+			for (int delta : {1, 7, 50, 1000})
+				expect_same_as_dijkstra(
+					g, shortest_paths_delta_stepping(g, seed, delta, pool), seed);
+		}
+	}
+}
+}
@@ -1,12 +1,48 @@
 #include <gtest/gtest.h>
 #include <graph/dfs.hpp>
 #include <graph/adjmatrix.hpp>
+#include <graph/bitmatrix.hpp>
 #include <graph/adjlist.hpp>
+#include <graph/csr.hpp>
+#include <graph/weighted_adjlist.hpp>
 
 namespace
 {
 using namespace graph;
 
+/// Graph providing only a list of outgoing vertices, no `at(edge)`.
+struct outgoing_only_graph {
+	using size_type = vertex;
+	std::vector<vertex_list> m;
+	size_type size() const { return m.size(); }
+	const vertex_list & outgoing(vertex v) const { return m[v]; }
+};
+
+/// Graph creating a new list of outgoing vertices for each call, counting the calls.
+struct outgoing_list_graph {
+	using size_type = vertex;
+	std::vector<vertex_list> m;
+	mutable std::size_t calls = 0;
+	size_type size() const { return m.size(); }
+	vertex_list outgoing(vertex v) const
+	{
+		++calls;
+		return m[v];
+	}
+};
+
+/// Graph providing only `for_each_outgoing`.
+struct for_each_only_graph {
+	using size_type = vertex;
+	std::vector<vertex_list> m;
+	size_type size() const { return m.size(); }
+	template <class Function> void for_each_outgoing(vertex v, Function && f) const
+	{
+		for (auto const u : m[v])
+			f(u);
+	}
+};
+
 class Test_dfs : public ::testing::Test
 {
 public:
@@ -74,4 +110,305 @@ TEST_F(Test_dfs, adjlist_graph_start_2) { test_dfs<adjlist>(vertex_list{2, 3, 0,
 TEST_F(Test_dfs, adjlist_graph_start_3) { test_dfs<adjlist>(vertex_list{3, 0, 1, 2, 4}, 3); }
 
 TEST_F(Test_dfs, adjlist_graph_start_4) { test_dfs<adjlist>(vertex_list{4}, 4); }
+
+TEST_F(Test_dfs, csr_empty_graph) { test_empty_graph<csr>(); }
+
+TEST_F(Test_dfs, csr_invalid_node) { test_invalid_node<csr>(); }
+
+TEST_F(Test_dfs, csr_graph_start_0) { test_dfs<csr>(vertex_list{0, 1, 3, 2, 4}, 0); }
+
+TEST_F(Test_dfs, csr_graph_start_1) { test_dfs<csr>(vertex_list{1, 3, 0, 2, 4}, 1); }
+
+TEST_F(Test_dfs, csr_graph_start_2) { test_dfs<csr>(vertex_list{2, 3, 0, 1, 4}, 2); }
+
+TEST_F(Test_dfs, csr_graph_start_3) { test_dfs<csr>(vertex_list{3, 0, 1, 2, 4}, 3); }
+
+TEST_F(Test_dfs, csr_graph_start_4) { test_dfs<csr>(vertex_list{4}, 4); }
+
+TEST_F(Test_dfs, bitmatrix_empty_graph) { test_empty_graph<bitmatrix>(); }
+
+TEST_F(Test_dfs, bitmatrix_invalid_node) { test_invalid_node<bitmatrix>(); }
+
+TEST_F(Test_dfs, bitmatrix_graph_start_0)
+{
+	test_dfs<bitmatrix>(vertex_list{0, 1, 3, 2, 4}, 0);
 }
+
+TEST_F(Test_dfs, bitmatrix_graph_start_1)
+{
+	test_dfs<bitmatrix>(vertex_list{1, 3, 0, 2, 4}, 1);
+}
+
+TEST_F(Test_dfs, bitmatrix_graph_start_2)
+{
+	test_dfs<bitmatrix>(vertex_list{2, 3, 0, 1, 4}, 2);
+}
+
+TEST_F(Test_dfs, bitmatrix_graph_start_3)
+{
+	test_dfs<bitmatrix>(vertex_list{3, 0, 1, 2, 4}, 3);
+}
+
+TEST_F(Test_dfs, bitmatrix_graph_start_4) { test_dfs<bitmatrix>(vertex_list{4}, 4); }
+
+TEST_F(Test_dfs, outgoing_only_graph)
+{
+	const outgoing_only_graph g{{{2, 1}, {}, {3}, {0, 1}}};
+	vertex_list v;
+	depth_first_search(g, 0, [&v](auto const &, auto vertex) { v.push_back(vertex); });
+	EXPECT_EQ((vertex_list{0, 2, 3, 1}), v);
+}
+
+TEST_F(Test_dfs, deep_graph)
+{
+	// path like graph, too deep for recursion
+	const vertex n = 300000;
+	edge_list edges;
+	for (vertex i = 0; i < n - 1; ++i)
+		edges.emplace_back(i, i + 1);
+	const csr g{n, edges};
+
+	vertex count = 0;
+	vertex last = vertex_invalid;
+	depth_first_search(g, 0, [&count, &last](auto const &, auto vertex) {
+		++count;
+		last = vertex;
+	});
+	EXPECT_EQ(n, count);
+	EXPECT_EQ(n - 1, last);
+}
+
+TEST_F(Test_dfs, pre_post_back_edge)
+{
+	const adjlist g{5, {{0, 1}, {1, 3}, {3, 0}, {2, 3}, {2, 4}, {3, 2}, {3, 4}}};
+
+	dfs_stack stack;
+	vertex_list pre;
+	vertex_list post;
+	edge_list back;
+	depth_first_search(g, 0, stack, [&pre](auto const &, vertex v) { pre.push_back(v); },
+		[&post](auto const &, vertex v) { post.push_back(v); },
+		[&back](auto const &, edge e) { back.push_back(e); });
+
+	EXPECT_EQ((vertex_list{0, 1, 3, 2, 4}), pre);
+	EXPECT_EQ((vertex_list{4, 2, 3, 1, 0}), post);
+	EXPECT_EQ((edge_list{{3, 0}, {2, 3}}), back);
+	EXPECT_TRUE(stack.empty());
+}
+
+TEST_F(Test_dfs, back_edge_self_loop)
+{
+	const adjmatrix g{2, {{0, 0}, {0, 1}}};
+
+	dfs_stack stack;
+	edge_list back;
+	depth_first_search(g, 0, stack, [](auto const &, vertex) {}, [](auto const &, vertex) {},
+		[&back](auto const &, edge e) { back.push_back(e); });
+
+	EXPECT_EQ((edge_list{{0, 0}}), back);
+}
+
+TEST_F(Test_dfs, reuse_stack)
+{
+	const csr g{4, {{0, 1}, {1, 2}, {2, 3}}};
+
+	dfs_stack stack;
+	vertex_list v;
+	depth_first_search(g, 0, stack, [&v](auto const &, vertex x) { v.push_back(x); });
+	depth_first_search(g, 2, stack, [&v](auto const &, vertex x) { v.push_back(x); });
+
+	EXPECT_EQ((vertex_list{0, 1, 2, 3, 2, 3}), v);
+}
+
+TEST_F(Test_dfs, no_back_edges_in_dag)
+{
+	const adjmatrix g{4, {{0, 1}, {0, 2}, {1, 3}, {2, 3}}};
+
+	dfs_stack stack;
+	edge_list back;
+	depth_first_search(g, 0, stack, [](auto const &, vertex) {}, [](auto const &, vertex) {},
+		[&back](auto const &, edge e) { back.push_back(e); });
+
+	EXPECT_TRUE(back.empty());
+}
+
+TEST_F(Test_dfs, sorted_adjlist_graph_start_0)
+{
+	test_dfs<sorted_adjlist>(vertex_list{0, 1, 3, 2, 4}, 0);
+}
+
+TEST_F(Test_dfs, weighted_adjlist_graph_start_0)
+{
+	test_dfs<weighted_adjlist<int>>(vertex_list{0, 1, 3, 2, 4}, 0);
+}
+
+TEST_F(Test_dfs, visitor_stop)
+{
+	const adjlist g{5, {{0, 1}, {1, 3}, {3, 0}, {2, 3}, {2, 4}, {3, 2}, {3, 4}}};
+
+	vertex_list v;
+	depth_first_search(g, 2, [&v](auto const &, vertex x) {
+		v.push_back(x);
+		return (x == 0) ? visit_result::stop : visit_result::proceed;
+	});
+	EXPECT_EQ((vertex_list{2, 3, 0}), v);
+}
+
+TEST_F(Test_dfs, visitor_skip)
+{
+	const adjlist g{5, {{0, 1}, {1, 3}, {3, 0}, {2, 3}, {2, 4}, {3, 2}, {3, 4}}};
+
+	dfs_stack stack;
+	vertex_list pre;
+	vertex_list post;
+	depth_first_search(g, 2, stack,
+		[&pre](auto const &, vertex x) {
+			pre.push_back(x);
+			return (x == 3) ? visit_result::skip : visit_result::proceed;
+		},
+		[&post](auto const &, vertex x) { post.push_back(x); });
+	EXPECT_EQ((vertex_list{2, 3, 4}), pre);
+	EXPECT_EQ((vertex_list{3, 4, 2}), post);
+}
+
+TEST_F(Test_dfs, visitor_skip_start)
+{
+	const adjlist g{5, {{0, 1}, {1, 3}, {3, 0}, {2, 3}, {2, 4}, {3, 2}, {3, 4}}};
+
+	vertex_list v;
+	depth_first_search(g, 0, [&v](auto const &, vertex x) {
+		v.push_back(x);
+		return visit_result::skip;
+	});
+	EXPECT_EQ((vertex_list{0}), v);
+}
+
+TEST_F(Test_dfs, stop_at_first_back_edge)
+{
+	const adjlist g{5, {{0, 1}, {1, 3}, {3, 0}, {2, 3}, {2, 4}, {3, 2}, {3, 4}}};
+
+	dfs_stack stack;
+	vertex_list pre;
+	edge_list back;
+	depth_first_search(g, 0, stack, [&pre](auto const &, vertex v) { pre.push_back(v); },
+		[](auto const &, vertex) {},
+		[&back](auto const &, edge e) {
+			back.push_back(e);
+			return visit_result::stop;
+		});
+
+	EXPECT_EQ((vertex_list{0, 1, 3}), pre);
+	EXPECT_EQ((edge_list{{3, 0}}), back);
+	EXPECT_TRUE(stack.empty());
+}
+
+TEST_F(Test_dfs, stop_in_post_visitor)
+{
+	const adjlist g{5, {{0, 1}, {1, 3}, {3, 0}, {2, 3}, {2, 4}, {3, 2}, {3, 4}}};
+
+	dfs_stack stack;
+	vertex_list post;
+	depth_first_search(g, 0, stack, [](auto const &, vertex) {},
+		[&post](auto const &, vertex v) {
+			post.push_back(v);
+			return (post.size() == 2) ? visit_result::stop : visit_result::proceed;
+		});
+
+	EXPECT_EQ((vertex_list{4, 2}), post);
+	EXPECT_TRUE(stack.empty());
+}
+
+TEST_F(Test_dfs, reuse_visited_sets)
+{
+	const adjlist g{5, {{0, 1}, {1, 3}, {3, 0}, {2, 3}, {2, 4}, {3, 2}, {3, 4}}};
+
+	dfs_stack stack;
+	visited_set visited;
+	visited_set finished;
+	vertex_list v;
+	edge_list back;
+	depth_first_search(g, 4, stack, visited, finished,
+		[&v](auto const &, vertex x) { v.push_back(x); });
+	EXPECT_EQ((vertex_list{4}), v);
+	EXPECT_EQ(1u, visited.count());
+
+	v.clear();
+	depth_first_search(g, 0, stack, visited, finished,
+		[&v](auto const &, vertex x) { v.push_back(x); }, [](auto const &, vertex) {},
+		[&back](auto const &, edge e) { back.push_back(e); });
+	EXPECT_EQ((vertex_list{0, 1, 3, 2, 4}), v);
+	EXPECT_EQ((edge_list{{3, 0}, {2, 3}}), back);
+	EXPECT_EQ(5u, visited.count());
+	EXPECT_TRUE(visited == finished);
+	EXPECT_TRUE(stack.empty());
+}
+
+TEST_F(Test_dfs, bitmatrix_word_cursor)
+{
+	// edges crossing word boundaries, searched word by word
+	const vertex n = 300;
+	std::vector<edge> edges;
+	for (vertex v = 0; v < n; ++v) {
+		edges.emplace_back(v, (v * 67 + 13) % n);
+		edges.emplace_back(v, (v * 131 + 7) % n);
+		edges.emplace_back(v, (v + 64) % n);
+	}
+	bitmatrix g{n};
+	for (auto const & e : edges)
+		g.add(e);
+	static_assert(detail::cursor_strategy_of<bitmatrix>::value
+			== detail::neighbors_strategy::member_cursor,
+		"bitmatrix must be searched word by word");
+
+	// sorted lists of outgoing vertices have the same order as the bitmatrix
+	adjlist sorted{n};
+	for (vertex v = 0; v < n; ++v)
+		for (auto const w : g.outgoing(v))
+			sorted.add(v, w);
+
+	dfs_stack stack;
+	vertex_list expected_pre;
+	vertex_list expected_post;
+	edge_list expected_back;
+	depth_first_search(sorted, 0, stack,
+		[&](auto const &, vertex v) { expected_pre.push_back(v); },
+		[&](auto const &, vertex v) { expected_post.push_back(v); },
+		[&](auto const &, edge e) { expected_back.push_back(e); });
+
+	vertex_list pre;
+	vertex_list post;
+	edge_list back;
+	depth_first_search(g, 0, stack, [&](auto const &, vertex v) { pre.push_back(v); },
+		[&](auto const &, vertex v) { post.push_back(v); },
+		[&](auto const &, edge e) { back.push_back(e); });
+
+	EXPECT_EQ(expected_pre, pre);
+	EXPECT_EQ(expected_post, post);
+	EXPECT_EQ(expected_back, back);
+	EXPECT_FALSE(back.empty());
+}
+
+TEST_F(Test_dfs, outgoing_list_graph_listed_once_per_vertex)
+{
+	outgoing_list_graph g{{{2, 1}, {3}, {3, 1}, {0}}};
+
+	dfs_stack stack;
+	vertex_list pre;
+	edge_list back;
+	depth_first_search(g, 0, stack, [&pre](auto const &, vertex v) { pre.push_back(v); },
+		[](auto const &, vertex) {}, [&back](auto const &, edge e) { back.push_back(e); });
+
+	EXPECT_EQ((vertex_list{0, 2, 3, 1}), pre);
+	EXPECT_EQ((edge_list{{3, 0}}), back);
+	EXPECT_EQ(4u, g.calls);
+}
+
+TEST_F(Test_dfs, for_each_only_graph)
+{
+	const for_each_only_graph g{{{2, 1}, {}, {3}, {0, 1}}};
+	vertex_list v;
+	depth_first_search(g, 0, [&v](auto const &, auto vertex) { v.push_back(vertex); });
+	EXPECT_EQ((vertex_list{0, 2, 3, 1}), v);
+}
+}
+
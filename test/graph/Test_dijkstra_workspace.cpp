@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include <graph/dijkstra_workspace.hpp>
+
+namespace
+{
+using graph::dijkstra_workspace;
+
+TEST(Test_dijkstra_workspace, construction)
+{
+	const dijkstra_workspace<int> ws{5};
+
+	EXPECT_EQ(5u, ws.size());
+	for (graph::vertex v = 0; v < ws.size(); ++v) {
+		EXPECT_FALSE(ws.reached(v));
+		EXPECT_EQ(dijkstra_workspace<int>::infinity, ws.distance(v));
+		EXPECT_EQ(graph::vertex_invalid, ws.predecessor(v));
+	}
+}
+
+TEST(Test_dijkstra_workspace, set)
+{
+	dijkstra_workspace<float> ws{3};
+
+	ws.set(1, 2.5f, 0);
+
+	EXPECT_TRUE(ws.reached(1));
+	EXPECT_EQ(2.5f, ws.distance(1));
+	EXPECT_EQ(0u, ws.predecessor(1));
+	EXPECT_FALSE(ws.reached(2));
+}
+
+TEST(Test_dijkstra_workspace, reset)
+{
+	dijkstra_workspace<int> ws{3};
+	ws.set(1, 2, 0);
+	ws.queue().push(2, 7);
+
+	ws.reset();
+
+	EXPECT_FALSE(ws.reached(1));
+	EXPECT_EQ(dijkstra_workspace<int>::infinity, ws.distance(1));
+	EXPECT_EQ(graph::vertex_invalid, ws.predecessor(1));
+	EXPECT_TRUE(ws.queue().empty());
+	EXPECT_FALSE(ws.queue().contains(2));
+}
+
+TEST(Test_dijkstra_workspace, set_after_reset)
+{
+	dijkstra_workspace<int> ws{3};
+	ws.set(1, 2, 0);
+	ws.reset();
+	ws.set(2, 4, 1);
+
+	EXPECT_FALSE(ws.reached(1));
+	EXPECT_TRUE(ws.reached(2));
+	EXPECT_EQ(4, ws.distance(2));
+}
+}
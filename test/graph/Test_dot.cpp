@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <graph/dot.hpp>
 #include <graph/adjmatrix.hpp>
+#include <graph/csr.hpp>
 
 namespace
 {
@@ -20,4 +21,18 @@ TEST(Test_dot, simple)
 				 "}\n",
 		s.c_str());
 }
+
+TEST(Test_dot, csr)
+{
+	const auto s = graph::dot(graph::csr{3, {{1, 2}, {0, 2}, {0, 1}}});
+	EXPECT_STREQ("digraph G {\n"
+				 "\t0;\n"
+				 "\t1;\n"
+				 "\t2;\n"
+				 "\t0 -> 1;\n"
+				 "\t0 -> 2;\n"
+				 "\t1 -> 2;\n"
+				 "}\n",
+		s.c_str());
+}
 }
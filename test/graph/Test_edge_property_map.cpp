@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <graph/edge_property_map.hpp>
+#include <graph/adjlist.hpp>
+#include <graph/adjmatrix.hpp>
+#include <graph/csr.hpp>
+
+namespace
+{
+
+TEST(Test_edge_property_map, construction)
+{
+	const graph::adjlist g{4, {{0, 1}, {0, 2}, {1, 3}}};
+	const graph::edge_property_map<int> p{g};
+
+	EXPECT_EQ(3u, p.size());
+	EXPECT_EQ(0, p[0]);
+	EXPECT_EQ(0, p[2]);
+}
+
+TEST(Test_edge_property_map, construction_with_value)
+{
+	const graph::adjlist g{4, {{0, 1}, {0, 2}, {1, 3}}};
+	const graph::edge_property_map<float> p{g, 2.5f};
+
+	EXPECT_EQ(2.5f, p[0]);
+	EXPECT_EQ(2.5f, p[2]);
+}
+
+TEST(Test_edge_property_map, offsets)
+{
+	const graph::adjlist g{4, {{0, 1}, {0, 2}, {2, 3}, {2, 0}, {2, 1}}};
+	const graph::edge_property_map<int> p{g};
+
+	EXPECT_EQ(0u, p.offset(0));
+	EXPECT_EQ(2u, p.offset(1));
+	EXPECT_EQ(2u, p.offset(2));
+	EXPECT_EQ(5u, p.offset(3));
+	EXPECT_EQ(5u, p.offset(4));
+}
+
+TEST(Test_edge_property_map, id_follows_storage_order)
+{
+	const graph::adjlist g{4, {{0, 2}, {0, 1}, {2, 3}, {2, 0}}};
+	const graph::edge_property_map<int> p{g};
+
+	EXPECT_EQ(0u, p.id(g, {0, 2}));
+	EXPECT_EQ(1u, p.id(g, {0, 1}));
+	EXPECT_EQ(2u, p.id(g, {2, 3}));
+	EXPECT_EQ(3u, p.id(g, {2, 0}));
+}
+
+TEST(Test_edge_property_map, id_of_missing_edge)
+{
+	const graph::adjlist g{4, {{0, 2}, {0, 1}}};
+	const graph::edge_property_map<int> p{g};
+
+	EXPECT_EQ(graph::edge_property_map<int>::npos, p.id(g, {0, 3}));
+	EXPECT_EQ(graph::edge_property_map<int>::npos, p.id(g, {1, 0}));
+	EXPECT_EQ(graph::edge_property_map<int>::npos, p.id(g, {4, 0}));
+}
+
+TEST(Test_edge_property_map, id_adjmatrix)
+{
+	const graph::adjmatrix g{3, {{2, 1}, {0, 2}, {2, 0}}};
+	const graph::edge_property_map<int> p{g};
+
+	EXPECT_EQ(0u, p.id(g, {0, 2}));
+	EXPECT_EQ(1u, p.id(g, {2, 0}));
+	EXPECT_EQ(2u, p.id(g, {2, 1}));
+}
+
+TEST(Test_edge_property_map, set)
+{
+	const graph::csr g{3, {{0, 1}, {0, 2}, {1, 2}}};
+	graph::edge_property_map<int> p{g};
+
+	EXPECT_TRUE(p.set(g, {0, 2}, 7));
+	EXPECT_TRUE(p.set(g, {1, 2}, 3));
+	EXPECT_FALSE(p.set(g, {2, 0}, 1));
+
+	EXPECT_EQ(0, p[p.id(g, {0, 1})]);
+	EXPECT_EQ(7, p[p.id(g, {0, 2})]);
+	EXPECT_EQ(3, p[p.id(g, {1, 2})]);
+}
+
+TEST(Test_edge_property_map, write_by_id)
+{
+	const graph::adjlist g{3, {{0, 1}, {1, 2}}};
+	graph::edge_property_map<int> p{g};
+
+	p[p.offset(1)] = 5;
+
+	EXPECT_EQ(5, p[p.id(g, {1, 2})]);
+}
+}
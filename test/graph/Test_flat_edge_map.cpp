@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <unordered_set>
+#include <graph/flat_edge_map.hpp>
+
+namespace
+{
+using graph::edge;
+using graph::flat_edge_map;
+
+/// Hash with many collisions, to test probing and removal.
+struct bad_hash {
+	std::size_t operator()(const edge & e) const { return e.from & 1; }
+};
+
+TEST(Test_flat_edge_map, edge_hash_distinct_on_grid)
+{
+	graph::edge_hash h;
+	std::unordered_set<std::size_t> values;
+	for (graph::vertex from = 0; from < 64; ++from)
+		for (graph::vertex to = 0; to < 64; ++to)
+			values.insert(h({from, to}));
+
+	EXPECT_EQ(64u * 64u, values.size());
+}
+
+TEST(Test_flat_edge_map, edge_hash_low_bits_spread)
+{
+	// the low bits select the slot in power of two sized tables
+	graph::edge_hash h;
+	std::unordered_set<std::size_t> slots;
+	for (graph::vertex from = 0; from < 32; ++from)
+		for (graph::vertex to = 0; to < 32; ++to)
+			slots.insert(h({from, to}) & 1023);
+
+	EXPECT_LT(600u, slots.size());
+}
+
+TEST(Test_flat_edge_map, edge_hash_not_symmetric)
+{
+	graph::edge_hash h;
+	EXPECT_NE(h({1, 2}), h({2, 1}));
+}
+
+TEST(Test_flat_edge_map, default_construction)
+{
+	const flat_edge_map<int> m;
+
+	EXPECT_TRUE(m.empty());
+	EXPECT_EQ(0u, m.size());
+	EXPECT_TRUE(m.find({0, 1}) == m.end());
+	EXPECT_TRUE(m.begin() == m.end());
+}
+
+TEST(Test_flat_edge_map, construction_initializer_list)
+{
+	const flat_edge_map<int> m{{{0, 1}, 1}, {{1, 2}, 2}, {{0, 1}, 3}};
+
+	EXPECT_EQ(2u, m.size());
+	EXPECT_EQ(1, m.find({0, 1})->second);
+	EXPECT_EQ(2, m.find({1, 2})->second);
+	EXPECT_EQ(edge(1, 2), m.find({1, 2})->first);
+}
+
+TEST(Test_flat_edge_map, insert)
+{
+	flat_edge_map<int> m;
+
+	auto const a = m.insert({0, 1}, 5);
+	EXPECT_TRUE(a.second);
+	EXPECT_EQ(5, a.first->second);
+
+	auto const b = m.insert({0, 1}, 6);
+	EXPECT_FALSE(b.second);
+	EXPECT_EQ(5, b.first->second);
+
+	EXPECT_FALSE(m.insert({graph::vertex_invalid, 1}, 1).second);
+	EXPECT_EQ(1u, m.size());
+}
+
+TEST(Test_flat_edge_map, index_operator)
+{
+	flat_edge_map<int> m;
+
+	m[{2, 3}] = 4;
+	m[{2, 3}] += 1;
+
+	EXPECT_EQ(1u, m.size());
+	EXPECT_EQ(5, m.find({2, 3})->second);
+	EXPECT_EQ(0, m[edge(3, 2)]);
+	EXPECT_EQ(2u, m.size());
+}
+
+TEST(Test_flat_edge_map, growth)
+{
+	flat_edge_map<graph::vertex> m;
+	for (graph::vertex i = 0; i < 1000; ++i)
+		m.insert({i, i + 1}, i);
+
+	EXPECT_EQ(1000u, m.size());
+	EXPECT_LT(m.size(), m.capacity() * 3 / 4);
+	for (graph::vertex i = 0; i < 1000; ++i) {
+		ASSERT_EQ(1u, m.count({i, i + 1}));
+		EXPECT_EQ(i, m.find({i, i + 1})->second);
+	}
+	EXPECT_EQ(0u, m.count({1, 0}));
+}
+
+TEST(Test_flat_edge_map, iteration)
+{
+	const flat_edge_map<int> m{{{0, 1}, 1}, {{1, 2}, 2}, {{2, 0}, 4}};
+
+	int sum = 0;
+	std::size_t n = 0;
+	for (auto const & e : m) {
+		sum += e.second;
+		++n;
+	}
+
+	EXPECT_EQ(3u, n);
+	EXPECT_EQ(7, sum);
+}
+
+TEST(Test_flat_edge_map, erase)
+{
+	flat_edge_map<int> m{{{0, 1}, 1}, {{1, 2}, 2}};
+
+	EXPECT_EQ(1u, m.erase({0, 1}));
+	EXPECT_EQ(0u, m.erase({0, 1}));
+	EXPECT_EQ(1u, m.size());
+	EXPECT_TRUE(m.find({0, 1}) == m.end());
+	EXPECT_EQ(2, m.find({1, 2})->second);
+}
+
+TEST(Test_flat_edge_map, erase_with_collisions)
+{
+	flat_edge_map<int, bad_hash> m;
+	for (graph::vertex i = 0; i < 5; ++i)
+		m.insert({2 * i, 0}, static_cast<int>(i));
+	m.insert({1, 0}, 10);
+
+	m.erase({2, 0});
+	m.erase({0, 0});
+
+	EXPECT_EQ(4u, m.size());
+	EXPECT_EQ(2, m.find({4, 0})->second);
+	EXPECT_EQ(3, m.find({6, 0})->second);
+	EXPECT_EQ(4, m.find({8, 0})->second);
+	EXPECT_EQ(10, m.find({1, 0})->second);
+	EXPECT_TRUE(m.find({2, 0}) == m.end());
+}
+
+TEST(Test_flat_edge_map, clear)
+{
+	flat_edge_map<int> m{{{0, 1}, 1}, {{1, 2}, 2}};
+	auto const capacity = m.capacity();
+
+	m.clear();
+
+	EXPECT_TRUE(m.empty());
+	EXPECT_EQ(capacity, m.capacity());
+	EXPECT_TRUE(m.find({0, 1}) == m.end());
+}
+}
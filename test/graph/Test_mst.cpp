@@ -3,6 +3,9 @@
 #include <graph/mst.hpp>
 #include <graph/adjmatrix.hpp>
 #include <graph/adjlist.hpp>
+#include <graph/csr.hpp>
+#include <graph/weighted_adjlist.hpp>
+#include <graph/edge_property_map.hpp>
 
 namespace
 {
@@ -11,9 +14,9 @@ using namespace graph;
 class Test_mst : public ::testing::Test
 {
 public:
-	static adjmatrix create_simple_bi()
+	template <class Graph = adjmatrix> static Graph create_simple_bi()
 	{
-		adjmatrix g{5};
+		Graph g{5};
 		g.add(0, 1, edge::type::bi, 1);
 		g.add(0, 2, edge::type::bi, 2);
 		g.add(1, 2, edge::type::bi, 2);
@@ -43,6 +46,40 @@ public:
 
 		EXPECT_EQ(expected, edges);
 	}
+
+	template <class Graph> void test_edge_property_map_int() const
+	{
+		const Graph g{5, {{0, 1}, {1, 0}, {0, 2}, {2, 0}, {1, 2}, {2, 1}, {1, 3}, {3, 1},
+							 {2, 3}, {3, 2}, {2, 4}, {4, 2}, {3, 4}, {4, 3}}};
+
+		// edges in the property map are uni-directional
+		const std::map<edge, int> distances{{{{0, 1}, 1}, {{0, 2}, 2}, {{1, 2}, 2},
+			{{1, 3}, 3}, {{2, 3}, 1}, {{2, 4}, 5}, {{3, 4}, 1}}};
+		edge_property_map<int> p{g};
+		for (auto const & d : distances) {
+			p.set(g, d.first, d.second);
+			p.set(g, d.first.reverse(), d.second);
+		}
+
+		EXPECT_EQ((edge_list{{vertex_invalid, 0}, {0, 1}, {0, 2}, {2, 3}, {3, 4}}),
+			minimum_spanning_tree_prim(g, p, 0));
+		EXPECT_EQ((edge_list{{0, 1}, {2, 3}, {3, 4}, {0, 2}}),
+			minimum_spanning_tree_kruskal(g, p));
+	}
+
+	template <class Graph> void test_kruskal_property_map_int() const
+	{
+		Graph g{5, {{0, 1}, {1, 0}, {0, 2}, {2, 0}, {1, 2}, {2, 1}, {1, 3}, {3, 1}, {2, 3},
+					   {3, 2}, {2, 4}, {4, 2}, {3, 4}, {4, 3}}};
+
+		const std::map<edge, int> p{{{{0, 1}, 1}, {{1, 0}, 1}, {{0, 2}, 2}, {{2, 0}, 2},
+			{{1, 2}, 2}, {{2, 1}, 2}, {{1, 3}, 3}, {{3, 1}, 3}, {{2, 3}, 1}, {{3, 2}, 1},
+			{{2, 4}, 5}, {{4, 2}, 5}, {{3, 4}, 1}, {{4, 3}, 1}}};
+
+		const edge_list expected{{0, 1}, {2, 3}, {3, 4}, {0, 2}};
+
+		EXPECT_EQ(expected, minimum_spanning_tree_kruskal(g, p));
+	}
 };
 
 TEST_F(Test_mst, simple_bidirectional)
@@ -60,4 +97,80 @@ TEST_F(Test_mst, adjlist_bidirectional_property_map_int)
 {
 	test_bidirectional_property_map_int<adjlist>();
 }
+
+TEST_F(Test_mst, csr_bidirectional_property_map_int)
+{
+	test_bidirectional_property_map_int<csr>();
+}
+
+TEST_F(Test_mst, prim_uses_edge_weights)
+{
+	adjmatrix g{3};
+	g.add(0, 1, edge::type::bi, 5);
+	g.add(1, 2, edge::type::bi, 1);
+	g.add(0, 2, edge::type::bi, 6);
+
+	EXPECT_EQ(
+		(edge_list{{vertex_invalid, 0}, {0, 1}, {1, 2}}), minimum_spanning_tree_prim(g, 0));
+}
+
+TEST_F(Test_mst, kruskal_simple_bidirectional)
+{
+	EXPECT_EQ((edge_list{{0, 1}, {2, 3}, {3, 4}, {0, 2}}),
+		minimum_spanning_tree_kruskal(create_simple_bi()));
+}
+
+TEST_F(Test_mst, kruskal_forest)
+{
+	adjmatrix g{5};
+	g.add(0, 1, edge::type::bi, 2);
+	g.add(1, 2, edge::type::bi, 1);
+	g.add(0, 2, edge::type::bi, 3);
+	g.add(3, 4, edge::type::bi, 4);
+
+	EXPECT_EQ((edge_list{{1, 2}, {0, 1}, {3, 4}}), minimum_spanning_tree_kruskal(g));
+}
+
+TEST_F(Test_mst, adjmatrix_kruskal_property_map_int)
+{
+	test_kruskal_property_map_int<adjmatrix>();
+}
+
+TEST_F(Test_mst, adjlist_kruskal_property_map_int) { test_kruskal_property_map_int<adjlist>(); }
+
+TEST_F(Test_mst, csr_kruskal_property_map_int) { test_kruskal_property_map_int<csr>(); }
+
+TEST_F(Test_mst, weighted_adjlist_simple_bidirectional)
+{
+	EXPECT_EQ((edge_list{{vertex_invalid, 0}, {0, 1}, {0, 2}, {2, 3}, {3, 4}}),
+		minimum_spanning_tree_prim(create_simple_bi<weighted_adjlist<int>>(), 0));
+}
+
+TEST_F(Test_mst, weighted_adjlist_prim_uses_edge_weights)
+{
+	weighted_adjlist<int> g{3};
+	g.add(0, 1, edge::type::bi, 5);
+	g.add(1, 2, edge::type::bi, 1);
+	g.add(0, 2, edge::type::bi, 6);
+
+	EXPECT_EQ(
+		(edge_list{{vertex_invalid, 0}, {0, 1}, {1, 2}}), minimum_spanning_tree_prim(g, 0));
+}
+
+TEST_F(Test_mst, weighted_adjlist_kruskal_simple_bidirectional)
+{
+	EXPECT_EQ((edge_list{{0, 1}, {2, 3}, {3, 4}, {0, 2}}),
+		minimum_spanning_tree_kruskal(create_simple_bi<weighted_adjlist<int>>()));
+}
+
+TEST_F(Test_mst, weighted_adjlist_bidirectional_property_map_int)
+{
+	test_bidirectional_property_map_int<weighted_adjlist<int>>();
+}
+
+TEST_F(Test_mst, adjmatrix_edge_property_map_int) { test_edge_property_map_int<adjmatrix>(); }
+
+TEST_F(Test_mst, adjlist_edge_property_map_int) { test_edge_property_map_int<adjlist>(); }
+
+TEST_F(Test_mst, csr_edge_property_map_int) { test_edge_property_map_int<csr>(); }
 }
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include <graph/neighbors.hpp>
+#include <graph/adjmatrix.hpp>
+#include <graph/adjlist.hpp>
+#include <graph/bitmatrix.hpp>
+#include <graph/csr.hpp>
+
+namespace
+{
+using namespace graph;
+
+/// Graph providing only a list of outgoing vertices, no `at(edge)`.
+struct outgoing_only_graph {
+	using size_type = vertex;
+	std::vector<vertex_list> m;
+	size_type size() const { return m.size(); }
+	const vertex_list & outgoing(vertex v) const { return m[v]; }
+};
+
+/// Graph providing only `for_each_outgoing`, which is not resumable.
+struct for_each_only_graph {
+	using size_type = vertex;
+	std::vector<vertex_list> m;
+	size_type size() const { return m.size(); }
+	template <class Function> void for_each_outgoing(vertex v, Function && f) const
+	{
+		for (auto const u : m[v])
+			f(u);
+	}
+};
+
+/// Graph creating a new list of outgoing vertices for each call.
+struct outgoing_list_graph {
+	using size_type = vertex;
+	std::vector<vertex_list> m;
+	size_type size() const { return m.size(); }
+	vertex_list outgoing(vertex v) const { return m[v]; }
+};
+
+template <class Graph> detail::neighbors_strategy strategy()
+{
+	return detail::neighbors_strategy_of<Graph>::value;
+}
+
+template <class Graph> detail::neighbors_strategy cursor_strategy()
+{
+	return detail::cursor_strategy_of<Graph>::value;
+}
+
+template <class Graph> vertex_list neighbors(const Graph & g, vertex v)
+{
+	vertex_list result;
+	detail::for_each_outgoing(g, v, [&result](vertex u) { result.push_back(u); });
+	return result;
+}
+
+TEST(Test_neighbors, strategy)
+{
+	EXPECT_TRUE(detail::neighbors_strategy::probe_at == strategy<adjmatrix>());
+	EXPECT_TRUE(detail::neighbors_strategy::outgoing_view == strategy<adjlist>());
+	EXPECT_TRUE(detail::neighbors_strategy::outgoing_view == strategy<csr>());
+	EXPECT_TRUE(detail::neighbors_strategy::member == strategy<bitmatrix>());
+	EXPECT_TRUE(detail::neighbors_strategy::outgoing_view == strategy<outgoing_only_graph>());
+}
+
+/// Outgoing vertices enumerated step by step.
+template <class Graph> vertex_list neighbors_by_cursor(const Graph & g, vertex v)
+{
+	vertex_list result;
+	vertex_list buffer;
+	std::size_t cursor = detail::begin_outgoing(g, v, buffer);
+	for (vertex u = detail::next_outgoing(g, v, cursor, buffer); u != vertex_invalid;
+		 u = detail::next_outgoing(g, v, cursor, buffer))
+		result.push_back(u);
+	EXPECT_TRUE(buffer.empty());
+	return result;
+}
+
+TEST(Test_neighbors, cursor_strategy)
+{
+	EXPECT_TRUE(detail::neighbors_strategy::probe_at == cursor_strategy<adjmatrix>());
+	EXPECT_TRUE(detail::neighbors_strategy::outgoing_view == cursor_strategy<adjlist>());
+	EXPECT_TRUE(detail::neighbors_strategy::outgoing_view == cursor_strategy<csr>());
+	EXPECT_TRUE(detail::neighbors_strategy::member_cursor == cursor_strategy<bitmatrix>());
+	EXPECT_TRUE(
+		detail::neighbors_strategy::outgoing_view == cursor_strategy<outgoing_only_graph>());
+	EXPECT_TRUE(detail::neighbors_strategy::member == cursor_strategy<for_each_only_graph>());
+	EXPECT_TRUE(detail::neighbors_strategy::member == cursor_strategy<outgoing_list_graph>());
+}
+
+TEST(Test_neighbors, is_traversable)
+{
+	EXPECT_TRUE(detail::is_traversable<adjmatrix>::value);
+	EXPECT_TRUE(detail::is_traversable<adjlist>::value);
+	EXPECT_TRUE(detail::is_traversable<csr>::value);
+	EXPECT_TRUE(detail::is_traversable<bitmatrix>::value);
+	EXPECT_TRUE(detail::is_traversable<outgoing_only_graph>::value);
+	EXPECT_FALSE(detail::is_traversable<vertex_list>::value);
+}
+
+TEST(Test_neighbors, for_each_outgoing)
+{
+	EXPECT_EQ((vertex_list{1, 3}), neighbors(adjmatrix{4, {{0, 3}, {0, 1}, {1, 2}}}, 0));
+	EXPECT_EQ((vertex_list{3, 1}), neighbors(adjlist{4, {{0, 3}, {0, 1}, {1, 2}}}, 0));
+	EXPECT_EQ((vertex_list{1, 3}), neighbors(csr{4, {{0, 3}, {0, 1}, {1, 2}}}, 0));
+	EXPECT_EQ((vertex_list{1, 3}), neighbors(bitmatrix{4, {{0, 3}, {0, 1}, {1, 2}}}, 0));
+	EXPECT_EQ((vertex_list{2, 0}), neighbors(outgoing_only_graph{{{2, 0}, {}, {}}}, 0));
+}
+
+TEST(Test_neighbors, next_outgoing)
+{
+	const adjmatrix g_adjmatrix{4, {{0, 3}, {0, 1}, {1, 2}}};
+	const adjlist g_adjlist{4, {{0, 3}, {0, 1}, {1, 2}}};
+	const csr g_csr{4, {{0, 3}, {0, 1}, {1, 2}}};
+	const outgoing_only_graph g_outgoing{{{2, 0}, {}, {}}};
+	const for_each_only_graph g_for_each{{{2, 0}, {}, {}}};
+	const outgoing_list_graph g_list{{{2, 0}, {}, {}}};
+
+	EXPECT_EQ((vertex_list{1, 3}), neighbors_by_cursor(g_adjmatrix, 0));
+	EXPECT_EQ((vertex_list{3, 1}), neighbors_by_cursor(g_adjlist, 0));
+	EXPECT_EQ((vertex_list{1, 3}), neighbors_by_cursor(g_csr, 0));
+	EXPECT_EQ((vertex_list{2, 0}), neighbors_by_cursor(g_outgoing, 0));
+	EXPECT_EQ((vertex_list{2, 0}), neighbors_by_cursor(g_for_each, 0));
+	EXPECT_EQ((vertex_list{2, 0}), neighbors_by_cursor(g_list, 0));
+}
+
+TEST(Test_neighbors, next_outgoing_nested_in_buffer)
+{
+	const for_each_only_graph g{{{1, 2}, {2, 0}, {}}};
+
+	vertex_list buffer;
+	std::size_t outer = detail::begin_outgoing(g, 0, buffer);
+	EXPECT_EQ(1u, detail::next_outgoing(g, 0, outer, buffer));
+
+	// enumeration of vertex 1 in between
+	std::size_t inner = detail::begin_outgoing(g, 1, buffer);
+	EXPECT_EQ(2u, detail::next_outgoing(g, 1, inner, buffer));
+	EXPECT_EQ(0u, detail::next_outgoing(g, 1, inner, buffer));
+	EXPECT_EQ(vertex_invalid, detail::next_outgoing(g, 1, inner, buffer));
+
+	EXPECT_EQ(2u, detail::next_outgoing(g, 0, outer, buffer));
+	EXPECT_EQ(vertex_invalid, detail::next_outgoing(g, 0, outer, buffer));
+	EXPECT_TRUE(buffer.empty());
+}
+
+TEST(Test_neighbors, next_outgoing_bitmatrix)
+{
+	// edges within the first word, at word boundaries and in the last, partial word
+	const bitmatrix g{200, {{5, 0}, {5, 5}, {5, 63}, {5, 64}, {5, 127}, {5, 190}, {5, 199}}};
+	EXPECT_EQ((vertex_list{0, 5, 63, 64, 127, 190, 199}), neighbors_by_cursor(g, 5));
+	EXPECT_EQ(neighbors(g, 5), neighbors_by_cursor(g, 5));
+	EXPECT_EQ((vertex_list{}), neighbors_by_cursor(g, 6));
+	EXPECT_EQ((vertex_list{}), neighbors_by_cursor(g, 200));
+
+	// exhausted cursor stays exhausted
+	std::size_t cursor = 199;
+	EXPECT_EQ(199u, g.next_outgoing(5, cursor));
+	EXPECT_EQ(vertex_invalid, g.next_outgoing(5, cursor));
+	EXPECT_EQ(vertex_invalid, g.next_outgoing(5, cursor));
+}
+}
@@ -1,9 +1,16 @@
 #include <gtest/gtest.h>
+#include <cstdlib>
 #include <map>
+#include <random>
 #include <unordered_map>
 #include <graph/path.hpp>
 #include <graph/adjmatrix.hpp>
 #include <graph/adjlist.hpp>
+#include <graph/csr.hpp>
+#include <graph/bidirectional_adjlist.hpp>
+#include <graph/weighted_adjlist.hpp>
+#include <graph/edge_property_map.hpp>
+#include <graph/flat_edge_map.hpp>
 
 namespace
 {
@@ -12,9 +19,9 @@ using namespace graph;
 class Test_path : public ::testing::Test
 {
 public:
-	static adjmatrix create_simple_uni()
+	template <class Graph = adjmatrix> static Graph create_simple_uni()
 	{
-		adjmatrix g{5};
+		Graph g{5};
 		g.add(0, 1, edge::type::uni, 1);
 		g.add(0, 2, edge::type::uni, 2);
 		g.add(1, 2, edge::type::uni, 2);
@@ -25,9 +32,9 @@ public:
 		return g;
 	}
 
-	static adjmatrix create_cycle_uni()
+	template <class Graph = adjmatrix> static Graph create_cycle_uni()
 	{
-		adjmatrix g{5};
+		Graph g{5};
 		g.add(0, 1, edge::type::uni, 1);
 		g.add(0, 2, edge::type::uni, 2);
 		g.add(1, 2, edge::type::uni, 2);
@@ -41,9 +48,9 @@ public:
 		return g;
 	}
 
-	static adjmatrix create_simple_bi()
+	template <class Graph = adjmatrix> static Graph create_simple_bi()
 	{
-		adjmatrix g{5};
+		Graph g{5};
 		g.add(0, 1, edge::type::bi, 1);
 		g.add(0, 2, edge::type::bi, 2);
 		g.add(1, 2, edge::type::bi, 2);
@@ -90,6 +97,49 @@ public:
 		EXPECT_EQ((vertex_list{2, 3, 4}), v);
 	}
 
+	template <class Graph> void test_distances_with_property_map_flat_edge_map_int() const
+	{
+		const Graph g{5,
+			{{0, 1}, {0, 2}, {1, 2}, {1, 3}, {2, 3}, {2, 4}, {3, 4}, {4, 0}, {3, 0}, {3, 1}}};
+
+		const flat_edge_map<int> distances{
+			{{0, 1}, 1}, {{0, 2}, 2}, {{1, 2}, 2}, {{1, 3}, 3}, {{2, 3}, 1}, {{2, 4}, 5},
+			{{3, 4}, 1}, {{4, 0}, 4}, {{3, 0}, 2}, {{3, 1}, 1},
+		};
+
+		vertex_list v;
+		bool reachable;
+		std::tie(v, reachable) = shortest_path_dijkstra(g, distances, 2, 4);
+
+		EXPECT_TRUE(reachable);
+		EXPECT_EQ((vertex_list{2, 3, 4}), v);
+	}
+
+	template <class Graph> void test_distances_with_edge_property_map_int() const
+	{
+		const Graph g{5,
+			{{0, 1}, {0, 2}, {1, 2}, {1, 3}, {2, 3}, {2, 4}, {3, 4}, {4, 0}, {3, 0}, {3, 1}}};
+
+		const std::map<edge, int> distances{
+			{{0, 1}, 1}, {{0, 2}, 2}, {{1, 2}, 2}, {{1, 3}, 3}, {{2, 3}, 1}, {{2, 4}, 5},
+			{{3, 4}, 1}, {{4, 0}, 4}, {{3, 0}, 2}, {{3, 1}, 1},
+		};
+		edge_property_map<int> p{g};
+		for (auto const & d : distances)
+			p.set(g, d.first, d.second);
+
+		vertex_list v;
+		bool reachable;
+
+		std::tie(v, reachable) = shortest_path_dijkstra(g, p, 2, 4);
+		EXPECT_TRUE(reachable);
+		EXPECT_EQ((vertex_list{2, 3, 4}), v);
+
+		std::tie(v, reachable) = shortest_path_dijkstra(g, p, 3, 2);
+		EXPECT_TRUE(reachable);
+		EXPECT_EQ((vertex_list{3, 1, 2}), v);
+	}
+
 	template <class Graph> void test_distances_with_property_map_float()
 	{
 		const Graph g{5,
@@ -201,6 +251,30 @@ TEST_F(Test_path, unreachable_destination)
 	EXPECT_EQ((vertex_list{}), v);
 }
 
+TEST_F(Test_path, unreachable_destination_with_successors)
+{
+	adjmatrix g{5, {{0, 1}, {3, 4}, {4, 2}}}; // node 2 only reachable from 3
+
+	vertex_list v;
+	bool reachable;
+	std::tie(v, reachable) = shortest_path_dijkstra(g, 0, 2);
+
+	EXPECT_FALSE(reachable);
+	EXPECT_EQ((vertex_list{}), v);
+}
+
+TEST_F(Test_path, invalid_vertices)
+{
+	vertex_list v;
+	bool reachable;
+
+	std::tie(v, reachable) = shortest_path_dijkstra(create_simple_uni(), 5, 0);
+	EXPECT_FALSE(reachable);
+
+	std::tie(v, reachable) = shortest_path_dijkstra(create_simple_uni(), 0, 5);
+	EXPECT_FALSE(reachable);
+}
+
 TEST_F(Test_path, adjmatrix_distances_with_property_map_int)
 {
 	test_distances_with_property_map_int<adjmatrix>();
@@ -230,4 +304,560 @@ TEST_F(Test_path, adjlist_distances_with_property_map_float)
 {
 	test_distances_with_property_map_float<adjlist>();
 }
+
+TEST_F(Test_path, csr_distances_with_property_map_int)
+{
+	test_distances_with_property_map_int<csr>();
+}
+
+TEST_F(Test_path, csr_distances_with_property_map_unordered_map_int)
+{
+	test_distances_with_property_map_unordered_map_int<csr>();
+}
+
+TEST_F(Test_path, csr_distances_with_property_map_float)
+{
+	test_distances_with_property_map_float<csr>();
+}
+
+TEST_F(Test_path, weighted_adjlist_simple_bidirectional_0_4)
+{
+	vertex_list v;
+	bool success;
+	std::tie(v, success)
+		= shortest_path_dijkstra(create_simple_bi<weighted_adjlist<int>>(), 0, 4);
+
+	EXPECT_TRUE(success);
+	EXPECT_EQ((vertex_list{0, 2, 3, 4}), v);
+}
+
+TEST_F(Test_path, weighted_adjlist_simple_unidirectional_0_3)
+{
+	vertex_list v;
+	bool success;
+	std::tie(v, success)
+		= shortest_path_dijkstra(create_simple_uni<weighted_adjlist<int>>(), 0, 3);
+
+	EXPECT_TRUE(success);
+	EXPECT_EQ((vertex_list{0, 2, 3}), v);
+}
+
+TEST_F(Test_path, weighted_adjlist_cycle_unidirectional_3_2)
+{
+	vertex_list v;
+	bool success;
+	std::tie(v, success)
+		= shortest_path_dijkstra(create_cycle_uni<weighted_adjlist<int>>(), 3, 2);
+
+	EXPECT_TRUE(success);
+	EXPECT_EQ((vertex_list{3, 1, 2}), v);
+}
+
+TEST_F(Test_path, weighted_adjlist_float)
+{
+	weighted_adjlist<float> g{4};
+	g.add(0, 1, edge::type::uni, 0.5f);
+	g.add(1, 3, edge::type::uni, 0.75f);
+	g.add(0, 2, edge::type::uni, 0.25f);
+	g.add(2, 3, edge::type::uni, 1.5f);
+
+	vertex_list v;
+	bool success;
+	std::tie(v, success) = shortest_path_dijkstra(g, 0, 3);
+
+	EXPECT_TRUE(success);
+	EXPECT_EQ((vertex_list{0, 1, 3}), v);
+}
+
+TEST_F(Test_path, weighted_adjlist_unreachable_destination)
+{
+	weighted_adjlist<int> g{5, {{0, 1}, {3, 4}, {4, 2}}};
+
+	vertex_list v;
+	bool reachable;
+	std::tie(v, reachable) = shortest_path_dijkstra(g, 0, 2);
+
+	EXPECT_FALSE(reachable);
+	EXPECT_EQ((vertex_list{}), v);
+}
+
+TEST_F(Test_path, weighted_adjlist_distances_with_property_map_int)
+{
+	test_distances_with_property_map_int<weighted_adjlist<int>>();
+}
+
+TEST_F(Test_path, adjmatrix_distances_with_edge_property_map_int)
+{
+	test_distances_with_edge_property_map_int<adjmatrix>();
+}
+
+TEST_F(Test_path, adjlist_distances_with_edge_property_map_int)
+{
+	test_distances_with_edge_property_map_int<adjlist>();
+}
+
+TEST_F(Test_path, csr_distances_with_edge_property_map_int)
+{
+	test_distances_with_edge_property_map_int<csr>();
+}
+
+TEST_F(Test_path, adjmatrix_distances_with_property_map_flat_edge_map_int)
+{
+	test_distances_with_property_map_flat_edge_map_int<adjmatrix>();
+}
+
+TEST_F(Test_path, adjlist_distances_with_property_map_flat_edge_map_int)
+{
+	test_distances_with_property_map_flat_edge_map_int<adjlist>();
+}
+
+TEST_F(Test_path, workspace_repeated_queries)
+{
+	const auto g = create_cycle_uni();
+	dijkstra_workspace<adjmatrix::value_type> ws{g.size()};
+	vertex_list path;
+
+	for (vertex start = 0; start < g.size(); ++start) {
+		for (vertex destination = 0; destination < g.size(); ++destination) {
+			vertex_list expected;
+			bool expected_found;
+			std::tie(expected, expected_found) = shortest_path_dijkstra(g, start, destination);
+
+			EXPECT_EQ(expected_found, shortest_path_dijkstra(g, start, destination, ws, path));
+			EXPECT_EQ(expected, path);
+		}
+	}
+}
+
+TEST_F(Test_path, workspace_distances)
+{
+	const auto g = create_simple_uni();
+	dijkstra_workspace<adjmatrix::value_type> ws{g.size()};
+	vertex_list path;
+
+	EXPECT_TRUE(shortest_path_dijkstra(g, 0, 4, ws, path));
+	EXPECT_EQ((vertex_list{0, 2, 3, 4}), path);
+	EXPECT_EQ(0, ws.distance(0));
+	EXPECT_EQ(3, ws.distance(3));
+	EXPECT_EQ(4, ws.distance(4));
+	EXPECT_EQ(3u, ws.predecessor(4));
+}
+
+TEST_F(Test_path, workspace_unreachable_destination)
+{
+	const adjmatrix g{5, {{0, 1}, {3, 4}, {4, 2}}};
+	dijkstra_workspace<adjmatrix::value_type> ws{g.size()};
+	vertex_list path{1, 2, 3};
+
+	EXPECT_FALSE(shortest_path_dijkstra(g, 0, 2, ws, path));
+	EXPECT_TRUE(path.empty());
+
+	EXPECT_TRUE(shortest_path_dijkstra(g, 3, 2, ws, path));
+	EXPECT_EQ((vertex_list{3, 4, 2}), path);
+	EXPECT_FALSE(ws.reached(0));
+}
+
+TEST_F(Test_path, workspace_too_small)
+{
+	const auto g = create_simple_uni();
+	dijkstra_workspace<adjmatrix::value_type> ws{2};
+	vertex_list path;
+
+	EXPECT_FALSE(shortest_path_dijkstra(g, 0, 1, ws, path));
+}
+
+TEST_F(Test_path, workspace_with_property_map)
+{
+	const adjlist g{5,
+		{{0, 1}, {0, 2}, {1, 2}, {1, 3}, {2, 3}, {2, 4}, {3, 4}, {4, 0}, {3, 0}, {3, 1}}};
+	const std::map<edge, float> distances{
+		{{0, 1}, 1.0}, {{0, 2}, 2.0}, {{1, 2}, 2.0}, {{1, 3}, 3.0}, {{2, 3}, 1.0},
+		{{2, 4}, 5.0}, {{3, 4}, 1.0}, {{4, 0}, 4.0}, {{3, 0}, 2.0}, {{3, 1}, 1.0},
+	};
+	dijkstra_workspace<float> ws{g.size()};
+	vertex_list path;
+
+	EXPECT_TRUE(shortest_path_dijkstra(g, distances, 2, 4, ws, path));
+	EXPECT_EQ((vertex_list{2, 3, 4}), path);
+	EXPECT_TRUE(shortest_path_dijkstra(g, distances, 3, 2, ws, path));
+	EXPECT_EQ((vertex_list{3, 1, 2}), path);
+}
+
+TEST_F(Test_path, search_stops_at_destination)
+{
+	const vertex n = 1000;
+	adjlist g{n};
+	for (vertex v = 0; v + 1 < n; ++v)
+		g.add(v, v + 1, edge::type::bi);
+	const edge_property_map<int> p{g, 1};
+	dijkstra_workspace<int> ws{n};
+	vertex_list path;
+
+	EXPECT_TRUE(shortest_path_dijkstra(g, p, 500, 502, ws, path));
+	EXPECT_EQ((vertex_list{500, 501, 502}), path);
+	EXPECT_TRUE(ws.reached(499));
+	EXPECT_FALSE(ws.reached(496));
+	EXPECT_FALSE(ws.reached(505));
+}
+
+TEST_F(Test_path, shortest_paths_distances)
+{
+	const auto tree = shortest_paths_dijkstra(create_simple_uni(), 0);
+
+	EXPECT_EQ(0u, tree.start);
+	EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 4}), tree.distance);
+	EXPECT_EQ((vertex_list{vertex_invalid, 0, 0, 2, 3}), tree.predecessor);
+}
+
+TEST_F(Test_path, shortest_paths_path)
+{
+	const auto tree = shortest_paths_dijkstra(create_cycle_uni(), 3);
+
+	EXPECT_EQ((vertex_list{3}), tree.path(3));
+	EXPECT_EQ((vertex_list{3, 0}), tree.path(0));
+	EXPECT_EQ((vertex_list{3, 1, 2}), tree.path(2));
+	EXPECT_EQ((vertex_list{3, 4}), tree.path(4));
+}
+
+TEST_F(Test_path, shortest_paths_same_as_single_destination)
+{
+	const auto g = create_cycle_uni();
+
+	for (vertex start = 0; start < g.size(); ++start) {
+		const auto tree = shortest_paths_dijkstra(g, start);
+		for (vertex destination = 0; destination < g.size(); ++destination) {
+			vertex_list v;
+			bool reachable;
+			std::tie(v, reachable) = shortest_path_dijkstra(g, start, destination);
+
+			EXPECT_EQ(reachable, tree.reachable(destination));
+			EXPECT_EQ(v, tree.path(destination));
+		}
+	}
+}
+
+TEST_F(Test_path, shortest_paths_unreachable)
+{
+	const adjmatrix g{5, {{0, 1}, {3, 4}, {4, 2}}};
+
+	const auto tree = shortest_paths_dijkstra(g, 0);
+
+	EXPECT_TRUE(tree.reachable(1));
+	EXPECT_FALSE(tree.reachable(2));
+	EXPECT_FALSE(tree.reachable(5));
+	EXPECT_EQ(shortest_path_tree<int>::infinity, tree.distance[3]);
+	EXPECT_EQ(vertex_invalid, tree.predecessor[3]);
+	EXPECT_EQ((vertex_list{}), tree.path(4));
+}
+
+TEST_F(Test_path, shortest_paths_invalid_start)
+{
+	const auto tree = shortest_paths_dijkstra(create_simple_uni(), 5);
+
+	EXPECT_TRUE(tree.distance.empty());
+	EXPECT_TRUE(tree.predecessor.empty());
+	EXPECT_FALSE(tree.reachable(0));
+}
+
+TEST_F(Test_path, shortest_paths_with_property_map)
+{
+	const csr g{5,
+		{{0, 1}, {0, 2}, {1, 2}, {1, 3}, {2, 3}, {2, 4}, {3, 4}, {4, 0}, {3, 0}, {3, 1}}};
+	const std::map<edge, float> distances{
+		{{0, 1}, 1.0}, {{0, 2}, 2.0}, {{1, 2}, 2.0}, {{1, 3}, 3.0}, {{2, 3}, 1.0},
+		{{2, 4}, 5.0}, {{3, 4}, 1.0}, {{4, 0}, 4.0}, {{3, 0}, 2.0}, {{3, 1}, 1.0},
+	};
+
+	const auto tree = shortest_paths_dijkstra(g, distances, 2);
+
+	EXPECT_EQ((std::vector<float>{3.0, 2.0, 0.0, 1.0, 2.0}), tree.distance);
+	EXPECT_EQ((vertex_list{2, 3, 4}), tree.path(4));
+}
+
+TEST_F(Test_path, bidirectional_same_as_unidirectional)
+{
+	const auto g = create_cycle_uni();
+
+	for (vertex start = 0; start < g.size(); ++start) {
+		for (vertex destination = 0; destination < g.size(); ++destination) {
+			EXPECT_EQ(shortest_path_dijkstra(g, start, destination),
+				shortest_path_bidirectional_dijkstra(g, start, destination));
+		}
+	}
+}
+
+TEST_F(Test_path, bidirectional_simple_bidirectional_0_4)
+{
+	vertex_list v;
+	bool success;
+	std::tie(v, success) = shortest_path_bidirectional_dijkstra(create_simple_bi(), 0, 4);
+
+	EXPECT_TRUE(success);
+	EXPECT_EQ((vertex_list{0, 2, 3, 4}), v);
+}
+
+TEST_F(Test_path, bidirectional_start_is_destination)
+{
+	vertex_list v;
+	bool success;
+	std::tie(v, success) = shortest_path_bidirectional_dijkstra(create_simple_uni(), 2, 2);
+
+	EXPECT_TRUE(success);
+	EXPECT_EQ((vertex_list{2}), v);
+}
+
+TEST_F(Test_path, bidirectional_unreachable_destination)
+{
+	const adjmatrix g{5, {{0, 1}, {3, 4}, {4, 2}}};
+
+	vertex_list v;
+	bool reachable;
+	std::tie(v, reachable) = shortest_path_bidirectional_dijkstra(g, 0, 2);
+
+	EXPECT_FALSE(reachable);
+	EXPECT_EQ((vertex_list{}), v);
+}
+
+TEST_F(Test_path, bidirectional_invalid_vertices)
+{
+	vertex_list v;
+	bool reachable;
+
+	std::tie(v, reachable) = shortest_path_bidirectional_dijkstra(create_simple_uni(), 5, 0);
+	EXPECT_FALSE(reachable);
+
+	std::tie(v, reachable) = shortest_path_bidirectional_dijkstra(create_simple_uni(), 0, 5);
+	EXPECT_FALSE(reachable);
+}
+
+TEST_F(Test_path, bidirectional_weighted_adjlist)
+{
+	vertex_list v;
+	bool success;
+	std::tie(v, success)
+		= shortest_path_bidirectional_dijkstra(create_cycle_uni<weighted_adjlist<int>>(), 3, 2);
+
+	EXPECT_TRUE(success);
+	EXPECT_EQ((vertex_list{3, 1, 2}), v);
+}
+
+TEST_F(Test_path, bidirectional_with_property_maps)
+{
+	const bidirectional_adjlist g{5,
+		{{0, 1}, {0, 2}, {1, 2}, {1, 3}, {2, 3}, {2, 4}, {3, 4}, {4, 0}, {3, 0}, {3, 1}}};
+	const std::map<edge, int> distances{
+		{{0, 1}, 1}, {{0, 2}, 2}, {{1, 2}, 2}, {{1, 3}, 3}, {{2, 3}, 1}, {{2, 4}, 5},
+		{{3, 4}, 1}, {{4, 0}, 4}, {{3, 0}, 2}, {{3, 1}, 1},
+	};
+	edge_property_map<int> p{g};
+	for (auto const & d : distances)
+		p.set(g, d.first, d.second);
+
+	EXPECT_EQ((std::make_tuple(vertex_list{2, 3, 4}, true)),
+		shortest_path_bidirectional_dijkstra(g, distances, 2, 4));
+	EXPECT_EQ((std::make_tuple(vertex_list{3, 1, 2}, true)),
+		shortest_path_bidirectional_dijkstra(g, p, 3, 2));
+}
+
+TEST_F(Test_path, bidirectional_random_graph)
+{
+	const vertex n = 200;
+	std::mt19937 rng{7};
+	std::uniform_int_distribution<vertex> random_vertex{0, n - 1};
+	std::uniform_int_distribution<int> random_weight{1, 20};
+
+	bidirectional_adjlist g{n};
+	std::map<edge, int> distances;
+	for (int i = 0; i < 800; ++i) {
+		const edge e{random_vertex(rng), random_vertex(rng)};
+		g.add(e);
+		distances.emplace(e, random_weight(rng));
+	}
+
+	auto const length = [&distances](const vertex_list & path) {
+		int sum = 0;
+		for (std::size_t i = 1; i < path.size(); ++i)
+			sum += distances.at({path[i - 1], path[i]});
+		return sum;
+	};
+
+	for (int i = 0; i < 200; ++i) {
+		const vertex start = random_vertex(rng);
+		const vertex destination = random_vertex(rng);
+
+		vertex_list expected;
+		bool expected_found;
+		std::tie(expected, expected_found)
+			= shortest_path_dijkstra(g, distances, start, destination);
+
+		vertex_list v;
+		bool found;
+		std::tie(v, found)
+			= shortest_path_bidirectional_dijkstra(g, distances, start, destination);
+
+		ASSERT_EQ(expected_found, found);
+		if (found) {
+			EXPECT_EQ(start, v.front());
+			EXPECT_EQ(destination, v.back());
+			EXPECT_EQ(length(expected), length(v));
+		}
+	}
+}
+
+TEST_F(Test_path, bidirectional_with_workspaces)
+{
+	const auto g = create_simple_bi();
+	dijkstra_workspace<adjmatrix::value_type> forward{g.size()};
+	dijkstra_workspace<adjmatrix::value_type> backward{g.size()};
+	vertex_list path{9, 9};
+
+	EXPECT_TRUE(shortest_path_bidirectional_dijkstra(g, 0, 4, forward, backward, path));
+	EXPECT_EQ(std::get<0>(shortest_path_bidirectional_dijkstra(g, 0, 4)), path);
+
+	// workspaces are reusable
+	EXPECT_TRUE(shortest_path_bidirectional_dijkstra(g, 4, 2, forward, backward, path));
+	EXPECT_EQ(std::get<0>(shortest_path_bidirectional_dijkstra(g, 4, 2)), path);
+
+	// too small workspaces
+	dijkstra_workspace<adjmatrix::value_type> small{2};
+	EXPECT_FALSE(shortest_path_bidirectional_dijkstra(g, 0, 4, forward, small, path));
+	EXPECT_TRUE(path.empty());
+}
+
+TEST_F(Test_path, astar_zero_heuristic_equals_dijkstra)
+{
+	const auto g = create_cycle_uni();
+	auto const zero = [](vertex) { return 0; };
+
+	for (vertex start = 0; start < g.size(); ++start)
+		for (vertex destination = 0; destination < g.size(); ++destination)
+			EXPECT_EQ(shortest_path_dijkstra(g, start, destination),
+				shortest_path_astar(g, start, destination, zero));
+}
+
+TEST_F(Test_path, astar_simple_uni_0_4)
+{
+	// exact remaining distances to vertex 4
+	const std::vector<int> remaining{4, 4, 2, 1, 0};
+
+	vertex_list v;
+	bool success;
+	std::tie(v, success) = shortest_path_astar(
+		create_simple_uni(), 0, 4, [&remaining](vertex u) { return remaining[u]; });
+
+	EXPECT_TRUE(success);
+	EXPECT_EQ((vertex_list{0, 2, 3, 4}), v);
+}
+
+TEST_F(Test_path, astar_unreachable_destination)
+{
+	adjmatrix g{3};
+	g.add(1, 0, edge::type::uni, 1);
+
+	vertex_list v;
+	bool reachable;
+	std::tie(v, reachable) = shortest_path_astar(g, 0, 1, [](vertex) { return 0; });
+
+	EXPECT_FALSE(reachable);
+	EXPECT_TRUE(v.empty());
+}
+
+TEST_F(Test_path, astar_invalid_vertices)
+{
+	auto const zero = [](vertex) { return 0; };
+
+	EXPECT_FALSE(std::get<1>(shortest_path_astar(create_simple_uni(), 5, 0, zero)));
+	EXPECT_FALSE(std::get<1>(shortest_path_astar(create_simple_uni(), 0, 5, zero)));
+}
+
+TEST_F(Test_path, astar_inconsistent_heuristic)
+{
+	// the heuristic of vertex 1 is admissible but not consistent: vertex 2 is
+	// settled first with distance 3, later reached with distance 2 via vertex 1
+	adjmatrix g{4};
+	g.add(0, 1, edge::type::uni, 1);
+	g.add(1, 2, edge::type::uni, 1);
+	g.add(0, 2, edge::type::uni, 3);
+	g.add(2, 3, edge::type::uni, 3);
+	const std::vector<int> estimate{0, 4, 0, 0};
+
+	vertex_list v;
+	bool success;
+	std::tie(v, success)
+		= shortest_path_astar(g, 0, 3, [&estimate](vertex u) { return estimate[u]; });
+
+	EXPECT_TRUE(success);
+	EXPECT_EQ((vertex_list{0, 1, 2, 3}), v);
+}
+
+TEST_F(Test_path, astar_with_property_maps)
+{
+	const adjlist g{5,
+		{{0, 1}, {0, 2}, {1, 2}, {1, 3}, {2, 3}, {2, 4}, {3, 4}, {4, 0}, {3, 0}, {3, 1}}};
+	const std::map<edge, int> distances{
+		{{0, 1}, 1}, {{0, 2}, 2}, {{1, 2}, 2}, {{1, 3}, 3}, {{2, 3}, 1}, {{2, 4}, 5},
+		{{3, 4}, 1}, {{4, 0}, 4}, {{3, 0}, 2}, {{3, 1}, 1},
+	};
+	edge_property_map<int> p{g};
+	for (auto const & d : distances)
+		p.set(g, d.first, d.second);
+	auto const zero = [](vertex) { return 0; };
+
+	EXPECT_EQ((std::make_tuple(vertex_list{2, 3, 4}, true)),
+		shortest_path_astar(g, distances, 2, 4, zero));
+	EXPECT_EQ((std::make_tuple(vertex_list{3, 1, 2}, true)),
+		shortest_path_astar(g, p, 3, 2, zero));
+
+	dijkstra_workspace<int> ws{g.size()};
+	vertex_list path;
+	EXPECT_TRUE(shortest_path_astar(g, p, 2, 4, zero, ws, path));
+	EXPECT_EQ((vertex_list{2, 3, 4}), path);
+}
+
+TEST_F(Test_path, astar_grid_settles_fewer_vertices)
+{
+	const vertex side = 30;
+	std::mt19937 rng{11};
+	std::uniform_int_distribution<int> random_weight{1, 5};
+
+	// grid with edge weights not smaller than the geometric distance
+	weighted_adjlist<int> g{side * side};
+	for (vertex y = 0; y < side; ++y) {
+		for (vertex x = 0; x < side; ++x) {
+			const vertex v = y * side + x;
+			if (x + 1 < side)
+				g.add({v, v + 1}, edge::type::bi, random_weight(rng));
+			if (y + 1 < side)
+				g.add({v, v + side}, edge::type::bi, random_weight(rng));
+		}
+	}
+
+	const vertex start = 10 * side + 5;
+	const vertex destination = 12 * side + 25;
+	auto const manhattan = [side, destination](vertex v) {
+		const int dx = static_cast<int>(v % side) - static_cast<int>(destination % side);
+		const int dy = static_cast<int>(v / side) - static_cast<int>(destination / side);
+		return std::abs(dx) + std::abs(dy);
+	};
+	auto const count_reached = [](const dijkstra_workspace<int> & ws) {
+		vertex n = 0;
+		for (vertex v = 0; v < ws.size(); ++v)
+			if (ws.reached(v))
+				++n;
+		return n;
+	};
+
+	dijkstra_workspace<int> ws{g.size()};
+	vertex_list path;
+
+	ASSERT_TRUE(shortest_path_dijkstra(g, start, destination, ws, path));
+	const int expected_distance = ws.distance(destination);
+	const vertex dijkstra_reached = count_reached(ws);
+
+	ASSERT_TRUE(shortest_path_astar(g, start, destination, manhattan, ws, path));
+	EXPECT_EQ(expected_distance, ws.distance(destination));
+	EXPECT_EQ(start, path.front());
+	EXPECT_EQ(destination, path.back());
+	EXPECT_LT(count_reached(ws), dijkstra_reached);
+}
 }
@@ -1,7 +1,10 @@
 #include <gtest/gtest.h>
 #include <graph/toposort.hpp>
 #include <graph/adjmatrix.hpp>
+#include <graph/bitmatrix.hpp>
 #include <graph/adjlist.hpp>
+#include <graph/bidirectional_adjlist.hpp>
+#include <graph/csr.hpp>
 
 namespace
 {
@@ -40,4 +43,46 @@ TEST_F(Test_toposort, adjmatrix_cycle) { test_cycle<adjmatrix>(); }
 TEST_F(Test_toposort, adjlist_no_cycle) { test_no_cycle<adjlist>(); }
 
 TEST_F(Test_toposort, adjlist_cycle) { test_cycle<adjlist>(); }
+
+TEST_F(Test_toposort, bitmatrix_no_cycle) { test_no_cycle<bitmatrix>(); }
+
+TEST_F(Test_toposort, bitmatrix_cycle) { test_cycle<bitmatrix>(); }
+
+TEST_F(Test_toposort, csr_no_cycle) { test_no_cycle<csr>(); }
+
+TEST_F(Test_toposort, csr_cycle) { test_cycle<csr>(); }
+
+TEST_F(Test_toposort, self_loop)
+{
+	vertex_list v;
+	bool success;
+	std::tie(v, success) = topological_sort(adjmatrix{3, {{0, 1}, {1, 1}, {1, 2}}});
+
+	EXPECT_FALSE(success);
+	EXPECT_EQ((vertex_list{}), v);
+}
+
+TEST_F(Test_toposort, large_chain)
+{
+	const vertex n = 100000;
+	edge_list edges;
+	for (vertex i = 0; i < n - 1; ++i)
+		edges.emplace_back(n - 1 - i, n - 2 - i);
+
+	vertex_list v;
+	bool success;
+	std::tie(v, success) = topological_sort(csr{n, edges});
+
+	ASSERT_TRUE(success);
+	ASSERT_EQ(n, v.size());
+	EXPECT_EQ(n - 1, v.front());
+	EXPECT_EQ(0u, v.back());
+}
+
+TEST_F(Test_toposort, bidirectional_adjlist_no_cycle)
+{
+	test_no_cycle<bidirectional_adjlist>();
+}
+
+TEST_F(Test_toposort, bidirectional_adjlist_cycle) { test_cycle<bidirectional_adjlist>(); }
 }
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <graph/visited_set.hpp>
+
+namespace
+{
+using namespace graph;
+
+TEST(Test_visited_set, default_construction)
+{
+	const visited_set s;
+	EXPECT_EQ(0u, s.size());
+	EXPECT_EQ(0u, s.count());
+}
+
+TEST(Test_visited_set, construction_empty)
+{
+	const visited_set s(130);
+	EXPECT_EQ(130u, s.size());
+	EXPECT_EQ(0u, s.count());
+	for (vertex v = 0; v < s.size(); ++v)
+		EXPECT_FALSE(s.test(v));
+}
+
+TEST(Test_visited_set, set_and_test)
+{
+	visited_set s(130);
+	s.set(0);
+	s.set(63);
+	s.set(64);
+	s.set(129);
+
+	EXPECT_EQ(4u, s.count());
+	for (vertex v = 0; v < s.size(); ++v)
+		EXPECT_EQ((v == 0) || (v == 63) || (v == 64) || (v == 129), s.test(v));
+}
+
+TEST(Test_visited_set, test_and_set)
+{
+	visited_set s(70);
+	EXPECT_FALSE(s.test_and_set(65));
+	EXPECT_TRUE(s.test(65));
+	EXPECT_TRUE(s.test_and_set(65));
+	EXPECT_EQ(1u, s.count());
+}
+
+TEST(Test_visited_set, reset)
+{
+	visited_set s(100);
+	s.set(1);
+	s.set(99);
+	s.reset();
+	EXPECT_EQ(100u, s.size());
+	EXPECT_EQ(0u, s.count());
+}
+
+TEST(Test_visited_set, reset_with_size)
+{
+	visited_set s(10);
+	s.set(3);
+
+	s.reset(200);
+	EXPECT_EQ(200u, s.size());
+	EXPECT_EQ(0u, s.count());
+	s.set(199);
+	EXPECT_TRUE(s.test(199));
+
+	s.reset(5);
+	EXPECT_EQ(5u, s.size());
+	EXPECT_EQ(0u, s.count());
+}
+
+TEST(Test_visited_set, union_and_intersection)
+{
+	visited_set a(100);
+	visited_set b(100);
+	a.set(1);
+	a.set(70);
+	b.set(70);
+	b.set(99);
+
+	visited_set u = a;
+	u |= b;
+	EXPECT_EQ(3u, u.count());
+	EXPECT_TRUE(u.test(1));
+	EXPECT_TRUE(u.test(70));
+	EXPECT_TRUE(u.test(99));
+
+	visited_set i = a;
+	i &= b;
+	EXPECT_EQ(1u, i.count());
+	EXPECT_TRUE(i.test(70));
+}
+
+TEST(Test_visited_set, comparison)
+{
+	visited_set a(100);
+	visited_set b(100);
+	EXPECT_TRUE(a == b);
+	a.set(42);
+	EXPECT_TRUE(a != b);
+	b.set(42);
+	EXPECT_TRUE(a == b);
+	EXPECT_TRUE(a != visited_set(101));
+}
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <graph/weighted_adjlist.hpp>
+
+namespace
+{
+
+TEST(Test_weighted_adjlist, default_construction)
+{
+	EXPECT_NO_THROW(graph::weighted_adjlist<int> g{4});
+}
+
+TEST(Test_weighted_adjlist, default_construction_status)
+{
+	const graph::weighted_adjlist<int> g{4};
+	EXPECT_EQ(4u, g.size());
+	EXPECT_EQ(0u, g.count_edges());
+}
+
+TEST(Test_weighted_adjlist, construction_initializer_list)
+{
+	const graph::weighted_adjlist<int> g{4, {{0, 1}, {0, 2}, {1, 3}}};
+	EXPECT_EQ(4u, g.size());
+	EXPECT_EQ(3u, g.count_edges());
+	EXPECT_EQ(1, g.at(0, 2));
+	EXPECT_EQ(0, g.at(2, 0));
+}
+
+TEST(Test_weighted_adjlist, add_edges_out_of_range)
+{
+	graph::weighted_adjlist<int> m{4};
+
+	EXPECT_FALSE(m.add(0, 4));
+	EXPECT_FALSE(m.add(4, 0));
+	EXPECT_EQ(0u, m.count_edges());
+}
+
+TEST(Test_weighted_adjlist, add_edges_with_value)
+{
+	graph::weighted_adjlist<double> m{3};
+
+	EXPECT_TRUE(m.add(0, 1, graph::edge::type::uni, 2.5));
+	EXPECT_TRUE(m.add(1, 2, graph::edge::type::bi, 0.5));
+
+	EXPECT_EQ(3u, m.count_edges());
+	EXPECT_EQ(2.5, m.at(0, 1));
+	EXPECT_EQ(0.0, m.at(1, 0));
+	EXPECT_EQ(0.5, m[graph::edge(2, 1)]);
+}
+
+TEST(Test_weighted_adjlist, add_existing_edge_replaces_value)
+{
+	graph::weighted_adjlist<int> m{3};
+
+	m.add(0, 1, graph::edge::type::uni, 4);
+	m.add(0, 1, graph::edge::type::uni, 7);
+
+	EXPECT_EQ(1u, m.count_edges());
+	EXPECT_EQ(7, m.at(0, 1));
+}
+
+TEST(Test_weighted_adjlist, weights_parallel_to_outgoing)
+{
+	graph::weighted_adjlist<int> m{4};
+	m.add(0, 3, graph::edge::type::uni, 30);
+	m.add(0, 1, graph::edge::type::uni, 10);
+	m.add(0, 2, graph::edge::type::uni, 20);
+
+	EXPECT_EQ((graph::vertex_list{3, 1, 2}), m.outgoing(0));
+	EXPECT_EQ((std::vector<int>{30, 10, 20}), m.weights(0));
+	EXPECT_EQ(3u, m.count_outgoing(0));
+	EXPECT_EQ(0u, m.count_outgoing(4));
+}
+
+TEST(Test_weighted_adjlist, remove)
+{
+	graph::weighted_adjlist<int> m{4};
+	m.add(0, 3, graph::edge::type::uni, 30);
+	m.add(0, 1, graph::edge::type::uni, 10);
+	m.add(0, 2, graph::edge::type::uni, 20);
+
+	EXPECT_TRUE(m.remove(0, 1));
+	EXPECT_FALSE(m.remove(0, 4));
+
+	EXPECT_EQ((graph::vertex_list{3, 2}), m.outgoing(0));
+	EXPECT_EQ((std::vector<int>{30, 20}), m.weights(0));
+}
+
+TEST(Test_weighted_adjlist, remove_bidirectional)
+{
+	graph::weighted_adjlist<int> m{3, {{0, 1}, {1, 0}, {1, 2}}};
+
+	m.remove(0, 1, graph::edge::type::bi);
+
+	EXPECT_EQ(1u, m.count_edges());
+	EXPECT_EQ((graph::edge_list{{1, 2}}), m.edges());
+}
+
+TEST(Test_weighted_adjlist, incoming)
+{
+	const graph::weighted_adjlist<int> m{4, {{0, 1}, {0, 2}, {0, 3}, {1, 0}, {1, 2}}};
+
+	EXPECT_EQ((graph::vertex_list{1}), m.incoming(0));
+	EXPECT_EQ((graph::vertex_list{0, 1}), m.incoming(2));
+	EXPECT_EQ(2u, m.count_incoming(2));
+	EXPECT_EQ(0u, m.count_incoming(4));
+	EXPECT_EQ((graph::vertex_list{}), m.incoming(4));
+}
+
+TEST(Test_weighted_adjlist, vertices)
+{
+	const graph::weighted_adjlist<int> m{3};
+
+	EXPECT_EQ((graph::vertex_list{0, 1, 2}), m.vertices());
+}
+}
@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <utils/bits.hpp>
+
+namespace
+{
+
+TEST(Test_utils_bits, words_for_bits)
+{
+	EXPECT_EQ(0u, utils::words_for_bits(0));
+	EXPECT_EQ(1u, utils::words_for_bits(1));
+	EXPECT_EQ(1u, utils::words_for_bits(64));
+	EXPECT_EQ(2u, utils::words_for_bits(65));
+}
+
+TEST(Test_utils_bits, popcount)
+{
+	EXPECT_EQ(0u, utils::popcount(0));
+	EXPECT_EQ(1u, utils::popcount(1));
+	EXPECT_EQ(64u, utils::popcount(~utils::word{0}));
+}
+
+TEST(Test_utils_bits, count_trailing_zeros)
+{
+	EXPECT_EQ(0u, utils::count_trailing_zeros(1));
+	EXPECT_EQ(3u, utils::count_trailing_zeros(8));
+	EXPECT_EQ(63u, utils::count_trailing_zeros(utils::word{1} << 63));
+}
+
+TEST(Test_utils_bits, for_each_bit)
+{
+	std::vector<unsigned> v;
+	utils::for_each_bit((utils::word{1} << 63) | 0x15, [&v](unsigned b) { v.push_back(b); });
+	EXPECT_EQ((std::vector<unsigned>{0, 2, 4, 63}), v);
+}
+}
@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+#include <utils/disjoint_set.hpp>
+
+namespace
+{
+
+TEST(Test_utils_disjoint_set, default_construction)
+{
+	EXPECT_NO_THROW(utils::disjoint_set s);
+}
+
+TEST(Test_utils_disjoint_set, construction_status)
+{
+	utils::disjoint_set s(5);
+	EXPECT_EQ(5u, s.size());
+	EXPECT_EQ(5u, s.count());
+	for (std::size_t i = 0; i < s.size(); ++i)
+		EXPECT_EQ(i, s.find(i));
+}
+
+TEST(Test_utils_disjoint_set, unite)
+{
+	utils::disjoint_set s(5);
+
+	EXPECT_TRUE(s.unite(0, 1));
+	EXPECT_EQ(4u, s.count());
+	EXPECT_TRUE(s.same(0, 1));
+	EXPECT_FALSE(s.same(0, 2));
+
+	EXPECT_TRUE(s.unite(2, 3));
+	EXPECT_TRUE(s.unite(1, 3));
+	EXPECT_EQ(2u, s.count());
+	EXPECT_TRUE(s.same(0, 2));
+	EXPECT_FALSE(s.same(0, 4));
+}
+
+TEST(Test_utils_disjoint_set, unite_same_set)
+{
+	utils::disjoint_set s(3);
+
+	EXPECT_TRUE(s.unite(0, 1));
+	EXPECT_TRUE(s.unite(1, 2));
+	EXPECT_FALSE(s.unite(2, 0));
+	EXPECT_EQ(1u, s.count());
+}
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <functional>
+#include <vector>
+#include <utils/indexed_priority_queue.hpp>
+
+namespace
+{
+
+TEST(Test_utils_indexed_priority_queue, default_construction)
+{
+	EXPECT_NO_THROW(utils::indexed_priority_queue<int> pq);
+}
+
+TEST(Test_utils_indexed_priority_queue, construction_status)
+{
+	utils::indexed_priority_queue<int> pq(10);
+	EXPECT_EQ(0u, pq.size());
+	EXPECT_EQ(10u, pq.capacity());
+	EXPECT_TRUE(pq.empty());
+	EXPECT_FALSE(pq.contains(0));
+	EXPECT_FALSE(pq.contains(10));
+}
+
+TEST(Test_utils_indexed_priority_queue, push)
+{
+	utils::indexed_priority_queue<int> pq(10);
+
+	pq.push(9, 90);
+	pq.push(0, 0);
+	pq.push(1, 10);
+
+	EXPECT_EQ(3u, pq.size());
+	EXPECT_TRUE(pq.contains(9));
+	EXPECT_TRUE(pq.contains(0));
+	EXPECT_TRUE(pq.contains(1));
+	EXPECT_FALSE(pq.contains(2));
+	EXPECT_EQ(90, pq.priority(9));
+}
+
+TEST(Test_utils_indexed_priority_queue, pop)
+{
+	utils::indexed_priority_queue<int> pq(4);
+	pq.push(0, 9);
+	pq.push(1, 0);
+	pq.push(2, 1);
+	pq.push(3, 8);
+
+	EXPECT_EQ(1u, pq.top());
+	EXPECT_EQ(0, pq.top_priority());
+	pq.pop();
+	EXPECT_FALSE(pq.contains(1));
+	EXPECT_EQ(3u, pq.size());
+
+	EXPECT_EQ(2u, pq.top());
+	pq.pop();
+	EXPECT_EQ(3u, pq.top());
+	pq.pop();
+	EXPECT_EQ(0u, pq.top());
+	pq.pop();
+	EXPECT_TRUE(pq.empty());
+}
+
+TEST(Test_utils_indexed_priority_queue, custom_compare)
+{
+	utils::indexed_priority_queue<int, std::greater<int>> pq(3);
+	pq.push(0, 1);
+	pq.push(1, 3);
+	pq.push(2, 2);
+
+	EXPECT_EQ(1u, pq.top());
+}
+
+TEST(Test_utils_indexed_priority_queue, decrease_key)
+{
+	utils::indexed_priority_queue<int> pq(4);
+	pq.push(0, 10);
+	pq.push(1, 20);
+	pq.push(2, 30);
+	pq.push(3, 40);
+
+	pq.decrease_key(3, 5);
+	EXPECT_EQ(3u, pq.top());
+	EXPECT_EQ(5, pq.priority(3));
+
+	pq.decrease_key(2, 15);
+	pq.pop();
+	EXPECT_EQ(0u, pq.top());
+	pq.pop();
+	EXPECT_EQ(2u, pq.top());
+}
+
+TEST(Test_utils_indexed_priority_queue, update)
+{
+	utils::indexed_priority_queue<int> pq(3);
+	pq.push(0, 10);
+	pq.push(1, 20);
+	pq.push(2, 30);
+
+	pq.update(0, 25);
+	EXPECT_EQ(1u, pq.top());
+	pq.update(2, 1);
+	EXPECT_EQ(2u, pq.top());
+}
+
+TEST(Test_utils_indexed_priority_queue, clear)
+{
+	utils::indexed_priority_queue<int> pq(3);
+	pq.push(0, 10);
+	pq.push(2, 30);
+
+	pq.clear();
+
+	EXPECT_TRUE(pq.empty());
+	EXPECT_FALSE(pq.contains(0));
+	EXPECT_FALSE(pq.contains(2));
+	EXPECT_EQ(3u, pq.capacity());
+
+	pq.push(2, 1);
+	EXPECT_EQ(2u, pq.top());
+}
+
+TEST(Test_utils_indexed_priority_queue, heap_order)
+{
+	const std::vector<int> values{5, 3, 9, 1, 7, 2, 8, 0, 6, 4};
+	utils::indexed_priority_queue<int> pq(values.size());
+	for (std::size_t i = 0; i < values.size(); ++i)
+		pq.push(i, values[i] + 100);
+	for (std::size_t i = 0; i < values.size(); ++i)
+		pq.decrease_key(i, values[i]);
+
+	std::vector<int> result;
+	while (!pq.empty()) {
+		result.push_back(pq.top_priority());
+		pq.pop();
+	}
+	EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}), result);
+}
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <numeric>
+#include <vector>
+#include <utils/thread_pool.hpp>
+
+namespace
+{
+
+TEST(Test_utils_thread_pool, default_construction)
+{
+	utils::thread_pool pool;
+	EXPECT_LE(1u, pool.size());
+}
+
+TEST(Test_utils_thread_pool, size)
+{
+	utils::thread_pool pool(4);
+	EXPECT_EQ(4u, pool.size());
+}
+
+TEST(Test_utils_thread_pool, single_thread_runs_on_caller)
+{
+	utils::thread_pool pool(1);
+	std::vector<std::size_t> indices;
+
+	pool.run([&indices](std::size_t i) { indices.push_back(i); });
+
+	EXPECT_EQ((std::vector<std::size_t>{0}), indices);
+}
+
+TEST(Test_utils_thread_pool, run_executes_once_per_thread)
+{
+	utils::thread_pool pool(4);
+	std::vector<int> calls(pool.size(), 0);
+
+	pool.run([&calls](std::size_t i) { ++calls[i]; });
+
+	EXPECT_EQ((std::vector<int>{1, 1, 1, 1}), calls);
+}
+
+TEST(Test_utils_thread_pool, run_waits_for_all_threads)
+{
+	utils::thread_pool pool(3);
+	std::vector<int> data(pool.size(), 0);
+
+	for (int round = 1; round <= 100; ++round) {
+		// every thread reads the data written by the others in the previous round
+		std::atomic<int> errors{0};
+		pool.run([&](std::size_t) {
+			for (auto const x : data)
+				if (x != round - 1)
+					++errors;
+		});
+		pool.run([&](std::size_t i) { data[i] = round; });
+		ASSERT_EQ(0, errors);
+	}
+	EXPECT_EQ(300, std::accumulate(std::begin(data), std::end(data), 0));
+}
+}